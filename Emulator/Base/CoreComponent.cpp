@@ -153,7 +153,7 @@ CoreComponent::routeOption(Option opt, std::vector<Configurable *> &result)
 */
 
 isize
-CoreComponent::size()
+CoreComponent::size(bool recursive)
 {
     SerCounter counter;
     *this << counter;
@@ -162,7 +162,7 @@ CoreComponent::size()
     // Add 8 bytes for the checksum
     result += 8;
     
-    for (CoreComponent *c : subComponents) { result += c->size(); }
+    if (recursive) for (CoreComponent *c : subComponents) { result += c->size(); }
     return result;
 }
 
@@ -178,6 +178,38 @@ CoreComponent::load(const u8 *buffer)
         ptr += c->load(ptr);
     }
 
+    // Load internal state of this component
+    ptr += loadState(ptr);
+
+    isize result = (isize)(ptr - buffer);
+    debug(SNP_DEBUG, "Loaded %ld bytes (expected %ld)\n", result, size());
+    return result;
+}
+
+isize
+CoreComponent::save(u8 *buffer)
+{
+    u8 *ptr = buffer;
+
+    // Save internal state of all subcomponents
+    for (CoreComponent *c : subComponents) {
+        ptr += c->save(ptr);
+    }
+
+    // Save internal state of this component
+    ptr += saveState(ptr);
+
+    isize result = (isize)(ptr - buffer);
+    debug(SNP_DEBUG, "Saved %ld bytes (expected %ld)\n", result, size());
+    assert(result == size());
+    return result;
+}
+
+isize
+CoreComponent::loadState(const u8 *buffer)
+{
+    const u8 *ptr = buffer;
+
     // Load the checksum for this component
     auto hash = read64(ptr);
 
@@ -191,21 +223,14 @@ CoreComponent::load(const u8 *buffer)
         throw Error(ERROR_SNAP_CORRUPTED);
     }
 
-    isize result = (isize)(ptr - buffer);
-    debug(SNP_DEBUG, "Loaded %ld bytes (expected %ld)\n", result, size());
-    return result;
+    return (isize)(ptr - buffer);
 }
 
 isize
-CoreComponent::save(u8 *buffer)
+CoreComponent::saveState(u8 *buffer)
 {
     u8 *ptr = buffer;
 
-    // Save internal state of all subcomponents
-    for (CoreComponent *c : subComponents) {
-        ptr += c->save(ptr);
-    }
-
     // Save the checksum for this component
     write64(ptr, checksum(false));
 
@@ -214,10 +239,8 @@ CoreComponent::save(u8 *buffer)
     *this << writer;
     ptr = writer.ptr;
 
-    isize result = (isize)(ptr - buffer);
-    debug(SNP_DEBUG, "Saved %ld bytes (expected %ld)\n", result, size());
-    assert(result == size());
-    return result;
+    assert((isize)(ptr - buffer) == size(false));
+    return (isize)(ptr - buffer);
 }
 
 std::vector<CoreComponent *> 
@@ -249,20 +272,69 @@ CoreComponent::postorderWalk(std::function<void(CoreComponent *)> func)
     func(this);
 }
 
+u64
+CoreComponent::hashTree(std::unordered_map<const CoreComponent *, u64> &hashes)
+{
+    SerChecker checker;
+
+    // Compute a checksum for the members of this component
+    *this << checker;
+
+    // Incoorporate subcomponents
+    for (auto &c : subComponents) checker << c->hashTree(hashes);
+
+    return hashes[this] = checker.hash;
+}
+
 void
 CoreComponent::diff(CoreComponent &other)
+{
+    std::unordered_map<const CoreComponent *, u64> hashes1, hashes2;
+
+    // Compute the checksums of all subtrees
+    hashTree(hashes1);
+    other.hashTree(hashes2);
+
+    diff(other, hashes1, hashes2);
+}
+
+void
+CoreComponent::diff(CoreComponent &other,
+                    std::unordered_map<const CoreComponent *, u64> &hashes1,
+                    std::unordered_map<const CoreComponent *, u64> &hashes2)
 {
     auto num = subComponents.size();
     assert(num == other.subComponents.size());
 
-    // Compare all subcomponents
+    // Skip identical subtrees
+    if (hashes1[this] == hashes2[&other]) return;
+
+    // Descend into the first diverging subcomponent
     for (usize i = 0; i < num; i++) {
-        subComponents[i]->diff(*other.subComponents[i]);
+
+        if (hashes1[subComponents[i]] != hashes2[other.subComponents[i]]) {
+
+            subComponents[i]->diff(*other.subComponents[i], hashes1, hashes2);
+            return;
+        }
     }
 
-    // Compare this component
-    if (auto check1 = checksum(false), check2 = other.checksum(false); check1 != check2) {
-        debug(true, "Checksum mismatch: %llx != %llx\n", check1, check2);
+    // The mismatch is located in this component. Compare all memory blocks.
+    std::vector<util::HashTree> trees1, trees2;
+    SerChecker checker1(trees1), checker2(trees2);
+    *this << checker1;
+    other << checker2;
+
+    debug(true, "Checksum mismatch: %llx != %llx\n", checker1.hash, checker2.hash);
+
+    for (usize i = 0; i < trees1.size() && i < trees2.size(); i++) {
+
+        if (auto block = trees1[i].firstMismatch(trees2[i]); block >= 0) {
+
+            auto offset = block * util::HashTree::blockSize;
+            debug(true, "Data block %zu differs at offset %lx (page %ld)\n", i, offset, block);
+            return;
+        }
     }
 }
 
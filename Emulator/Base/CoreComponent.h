@@ -21,6 +21,7 @@
 #include "Concurrency.h"
 #include <vector>
 #include <functional>
+#include <unordered_map>
 
 namespace vamiga {
 
@@ -145,7 +146,7 @@ public:
 public:
     
     // Returns the size of the internal state in bytes
-    isize size();
+    isize size(bool recursive = true);
 
     // Loads the internal state from a memory buffer
     virtual isize load(const u8 *buf) throws;
@@ -155,6 +156,10 @@ public:
     virtual isize save(u8 *buf);
     virtual void _didSave() { };
 
+    // Loads or saves the internal state of this component (w/o subcomponents)
+    isize loadState(const u8 *buf) throws;
+    isize saveState(u8 *buf);
+
 
     //
     // Working with subcomponents
@@ -175,9 +180,23 @@ public:
 
 public:
 
-    // Compares two components and reports differences (for debugging)
+    /* Compares two components and reports the first difference (for
+     * debugging). The function descends into the first diverging subtree
+     * and reports the first diverging memory page if possible.
+     */
     void diff(CoreComponent &other);
 
+private:
+
+    // Computes the checksums of all subtrees
+    u64 hashTree(std::unordered_map<const CoreComponent *, u64> &hashes);
+
+    void diff(CoreComponent &other,
+              std::unordered_map<const CoreComponent *, u64> &hashes1,
+              std::unordered_map<const CoreComponent *, u64> &hashes2);
+
+public:
+
     // Exports the current configuration to a script file
     void exportConfig(std::ostream& ss, bool diff = false) const;
 
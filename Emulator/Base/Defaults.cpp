@@ -44,6 +44,9 @@ Defaults::Defaults()
     setFallback(OPT_AMIGA_SPEED_BOOST,          100);
     setFallback(OPT_AMIGA_SNAPSHOTS,            false);
     setFallback(OPT_AMIGA_SNAPSHOT_DELAY,       10);
+    setFallback(OPT_AMIGA_SNAPSHOT_EMBED,       true);
+    setFallback(OPT_AMIGA_REWIND_INTERVAL,      0);
+    setFallback(OPT_AMIGA_REWIND_BUDGET,        64);
     setFallback(OPT_AMIGA_RUN_AHEAD,            0);
 
     setFallback(OPT_AGNUS_REVISION,             AGNUS_ECS_1MB);
@@ -52,6 +55,7 @@ Defaults::Defaults()
     setFallback(OPT_DENISE_REVISION,            DENISE_OCS);
     setFallback(OPT_DENISE_VIEWPORT_TRACKING,   true);
     setFallback(OPT_DENISE_FRAME_SKIPPING,      16);
+    setFallback(OPT_DENISE_VIDEO_OUTPUT,        true);
 
     setFallback(OPT_MON_PALETTE,                PALETTE_COLOR);
     setFallback(OPT_MON_BRIGHTNESS,             50);
@@ -85,6 +89,8 @@ Defaults::Defaults()
     setFallback(OPT_CPU_DASM_SYNTAX,            DASM_SYNTAX_MOIRA);
     setFallback(OPT_CPU_OVERCLOCKING,           0);
     setFallback(OPT_CPU_RESET_VAL,              0);
+    setFallback(OPT_CPU_INSTR_CACHE,            false);
+    setFallback(OPT_CPU_DECOUPLED,              false);
 
     setFallback(OPT_RTC_MODEL,                  RTC_OKI);
 
@@ -297,6 +297,15 @@ Error::Error(ErrorCode code, const string &s)
             description += " emulator into an inconsistent state.";
             break;
 
+        case ERROR_SNAP_MEDIA_MISMATCH:
+            description = "The snapshot refers to a disk that is not inserted.";
+            description += " Please insert the disk the snapshot was taken with.";
+            break;
+
+        case ERROR_SNAP_NO_REWIND_POINT:
+            description = "No rewind point has been recorded for the requested frame.";
+            break;
+
         case ERROR_DMS_CANT_CREATE:
             description = "Failed to extract the DMS archive.";
             break;
@@ -108,6 +108,8 @@ enum_long(ERROR_CODE)
     ERROR_SNAP_TOO_NEW,         ///< Snapshot was created with a later version
     ERROR_SNAP_IS_BETA,         ///< Snapshot was created with a beta release
     ERROR_SNAP_CORRUPTED,       ///< Snapshot data is corrupted
+    ERROR_SNAP_MEDIA_MISMATCH,  ///< Snapshot references a different disk
+    ERROR_SNAP_NO_REWIND_POINT, ///< No rewind point covers the requested frame
 
     // Media files
     ERROR_DMS_CANT_CREATE,
@@ -292,6 +294,8 @@ struct ErrorCodeEnum : util::Reflection<ErrorCodeEnum, ErrorCode>
             case ERROR_SNAP_TOO_OLD:                return "SNAP_TOO_OLD";
             case ERROR_SNAP_TOO_NEW:                return "SNAP_TOO_NEW";
             case ERROR_SNAP_IS_BETA:                return "SNAP_IS_BETA";
+            case ERROR_SNAP_MEDIA_MISMATCH:         return "SNAP_MEDIA_MISMATCH";
+            case ERROR_SNAP_NO_REWIND_POINT:        return "SNAP_NO_REWIND_POINT";
 
             case ERROR_DMS_CANT_CREATE:             return "DMS_CANT_CREATE";
             case ERROR_EXT_FACTOR5:                 return "EXT_UNSUPPORTED";
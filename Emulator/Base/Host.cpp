@@ -92,21 +92,19 @@ Host::tmp() const
 {
     SYNCHRONIZED
 
-    static fs::path base;
-
-    if (base.empty()) {
+    if (tmpDir.empty()) {
 
         // Use /tmp as default folder for temporary files
-        base = "/tmp";
+        tmpDir = "/tmp";
 
         // Open a file to see if we have write permissions
-        std::ofstream logfile(base / "virtualc64.log");
+        std::ofstream logfile(tmpDir / "virtualc64.log");
 
         // If /tmp is not accessible, use a different directory
         if (!logfile.is_open()) {
 
-            base = fs::temp_directory_path();
-            logfile.open(base / "vAmiga.log");
+            tmpDir = fs::temp_directory_path();
+            logfile.open(tmpDir / "vAmiga.log");
 
             if (!logfile.is_open()) {
 
@@ -115,10 +113,10 @@ Host::tmp() const
         }
 
         logfile.close();
-        fs::remove(base / "vAmiga.log");
+        fs::remove(tmpDir / "vAmiga.log");
     }
 
-    return base;
+    return tmpDir;
 }
 
 fs::path
@@ -39,6 +39,9 @@ class Host : public CoreComponent {
     // Current configuration
     HostConfig config = { };
 
+    // Folder for temporary files (determined on first use)
+    mutable fs::path tmpDir;
+
 
     //
     // Initializing
@@ -37,6 +37,9 @@ OptionParser::create(Option opt, i64 arg)
         case OPT_AMIGA_SPEED_BOOST:         return numParser("%");
         case OPT_AMIGA_SNAPSHOTS:           return boolParser();
         case OPT_AMIGA_SNAPSHOT_DELAY:      return numParser(" sec");
+        case OPT_AMIGA_SNAPSHOT_EMBED:      return boolParser();
+        case OPT_AMIGA_REWIND_INTERVAL:     return numParser(" frames");
+        case OPT_AMIGA_REWIND_BUDGET:       return numParser(" MB");
         case OPT_AMIGA_RUN_AHEAD:           return numParser(" frames");
 
         case OPT_AGNUS_REVISION:            return enumParser.template operator()<AgnusRevisionEnum>();
@@ -45,6 +48,7 @@ OptionParser::create(Option opt, i64 arg)
         case OPT_DENISE_REVISION:           return enumParser.template operator()<DeniseRevisionEnum>();
         case OPT_DENISE_VIEWPORT_TRACKING:  return boolParser();
         case OPT_DENISE_FRAME_SKIPPING:     return boolParser();
+        case OPT_DENISE_VIDEO_OUTPUT:       return boolParser();
         case OPT_DENISE_HIDDEN_BITPLANES:   return numParser();
         case OPT_DENISE_HIDDEN_SPRITES:     return numParser();
         case OPT_DENISE_HIDDEN_LAYERS:      return numParser();
@@ -85,6 +89,8 @@ OptionParser::create(Option opt, i64 arg)
         case OPT_CPU_DASM_SYNTAX:           return enumParser.template operator()<DasmSyntaxEnum>();
         case OPT_CPU_OVERCLOCKING:          return numParser("x");
         case OPT_CPU_RESET_VAL:             return numParser();
+        case OPT_CPU_INSTR_CACHE:           return boolParser();
+        case OPT_CPU_DECOUPLED:             return boolParser();
 
         case OPT_RTC_MODEL:                 return enumParser.template operator()<RTCRevisionEnum>();
 
@@ -32,6 +32,9 @@ enum_long(OPT)
     OPT_AMIGA_SPEED_BOOST,      ///< Speed adjustment in percent
     OPT_AMIGA_SNAPSHOTS,        ///< Automatically take a snapshots
     OPT_AMIGA_SNAPSHOT_DELAY,   ///< Delay between two snapshots in seconds
+    OPT_AMIGA_SNAPSHOT_EMBED,   ///< Embed unmodified disk images in snapshots
+    OPT_AMIGA_REWIND_INTERVAL,  ///< Frames between two rewind points
+    OPT_AMIGA_REWIND_BUDGET,    ///< Memory reserved for rewind points in MB
     OPT_AMIGA_RUN_AHEAD,        ///< Number of run-ahead frames
 
     // Agnus
@@ -42,6 +45,7 @@ enum_long(OPT)
     OPT_DENISE_REVISION,
     OPT_DENISE_VIEWPORT_TRACKING,
     OPT_DENISE_FRAME_SKIPPING,
+    OPT_DENISE_VIDEO_OUTPUT,
     OPT_DENISE_HIDDEN_BITPLANES,
     OPT_DENISE_HIDDEN_SPRITES,
     OPT_DENISE_HIDDEN_LAYERS,
@@ -87,6 +91,8 @@ enum_long(OPT)
     OPT_CPU_DASM_SYNTAX,
     OPT_CPU_OVERCLOCKING,
     OPT_CPU_RESET_VAL,
+    OPT_CPU_INSTR_CACHE,
+    OPT_CPU_DECOUPLED,
 
     // Real-time clock
     OPT_RTC_MODEL,
@@ -205,6 +211,9 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_AMIGA_SPEED_BOOST:         return "AMIGA.SPEED_BOOST";
             case OPT_AMIGA_SNAPSHOTS:           return "AMIGA.SNAPSHOTS";
             case OPT_AMIGA_SNAPSHOT_DELAY:      return "AMIGA.SNAPSHOT_DELAY";
+            case OPT_AMIGA_SNAPSHOT_EMBED:      return "AMIGA.SNAPSHOT_EMBED";
+            case OPT_AMIGA_REWIND_INTERVAL:     return "AMIGA.REWIND_INTERVAL";
+            case OPT_AMIGA_REWIND_BUDGET:       return "AMIGA.REWIND_BUDGET";
             case OPT_AMIGA_RUN_AHEAD:           return "AMIGA.RUN_AHEAD";
 
             case OPT_AGNUS_REVISION:            return "AGNUS.REVISION";
@@ -213,6 +222,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_DENISE_REVISION:           return "DENISE.REVISION";
             case OPT_DENISE_VIEWPORT_TRACKING:  return "DENISE.VIEWPORT_TRACKING";
             case OPT_DENISE_FRAME_SKIPPING:     return "DENISE.FRAME_SKIPPING";
+            case OPT_DENISE_VIDEO_OUTPUT:       return "DENISE.VIDEO_OUTPUT";
             case OPT_DENISE_HIDDEN_BITPLANES:   return "HIDDEN_BITPLANES";
             case OPT_DENISE_HIDDEN_SPRITES:     return "HIDDEN_SPRITES";
             case OPT_DENISE_HIDDEN_LAYERS:      return "HIDDEN_LAYERS";
@@ -253,6 +263,8 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_CPU_DASM_SYNTAX:           return "CPU.DASM_SYNTAX";
             case OPT_CPU_OVERCLOCKING:          return "CPU.OVERCLOCKING";
             case OPT_CPU_RESET_VAL:             return "CPU.RESET_VAL";
+            case OPT_CPU_INSTR_CACHE:           return "CPU.INSTR_CACHE";
+            case OPT_CPU_DECOUPLED:             return "CPU.DECOUPLED";
 
             case OPT_RTC_MODEL:                 return "RTC.MODEL";
 
@@ -349,6 +361,9 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_AMIGA_SPEED_BOOST:         return "Speed adjustment";
             case OPT_AMIGA_SNAPSHOTS:           return "Automatically take snapshots";
             case OPT_AMIGA_SNAPSHOT_DELAY:      return "Time span between two snapshots";
+            case OPT_AMIGA_SNAPSHOT_EMBED:      return "Embed unmodified disk images in snapshots";
+            case OPT_AMIGA_REWIND_INTERVAL:     return "Time span between two rewind points";
+            case OPT_AMIGA_REWIND_BUDGET:       return "Memory reserved for rewind points";
             case OPT_AMIGA_RUN_AHEAD:           return "Run-ahead frames";
 
             case OPT_AGNUS_REVISION:            return "Chip revision";
@@ -357,6 +372,7 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_DENISE_REVISION:           return "Chip revision";
             case OPT_DENISE_VIEWPORT_TRACKING:  return "Track the currently used viewport";
             case OPT_DENISE_FRAME_SKIPPING:     return "Reduce frame rate in warp mode";
+            case OPT_DENISE_VIDEO_OUTPUT:       return "Render frames";
             case OPT_DENISE_HIDDEN_BITPLANES:   return "Hide bitplanes";
             case OPT_DENISE_HIDDEN_SPRITES:     return "Hide sprites";
             case OPT_DENISE_HIDDEN_LAYERS:      return "Hide playfields";
@@ -397,6 +413,8 @@ struct OptionEnum : util::Reflection<OptionEnum, Option>
             case OPT_CPU_DASM_SYNTAX:           return "Disassembler syntax";
             case OPT_CPU_OVERCLOCKING:          return "Overclocking factor";
             case OPT_CPU_RESET_VAL:             return "Register reset value";
+            case OPT_CPU_INSTR_CACHE:           return "Predecoded instruction cache";
+            case OPT_CPU_DECOUPLED:             return "Run an overclocked CPU ahead of Agnus";
 
             case OPT_RTC_MODEL:                 return "Chip revision";
 
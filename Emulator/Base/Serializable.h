@@ -12,6 +12,7 @@
 #include "Macros.h"
 #include "MemUtils.h"
 #include "Buffer.h"
+#include "HashTree.h"
 #include "RingBuffer.h"
 #include <cassert>
 #include <concepts>
@@ -118,6 +119,61 @@ inline void writeString(u8 *& buf, string value)
 }
 
 
+//
+// Bulk memory buffer I/O
+//
+
+/* Arrays of integers and enums are stored as a single memory block. Each
+ * element occupies its native size and is stored in little endian format.
+ * Hence, the data is transferred with a single memcpy on little endian hosts.
+ * Big endian hosts normalize the byte order of each element.
+ */
+template <class T> constexpr bool isBulkType =
+(std::is_integral_v<T> || std::is_enum_v<T>) && !std::is_same_v<T, bool>;
+
+template <class T> inline T swapBytes(T value)
+{
+    if constexpr (sizeof(T) == 2) {
+        return std::bit_cast<T>(SWAP16(std::bit_cast<u16>(value)));
+    } else if constexpr (sizeof(T) == 4) {
+        return std::bit_cast<T>(SWAP32(std::bit_cast<u32>(value)));
+    } else if constexpr (sizeof(T) == 8) {
+        return std::bit_cast<T>(SWAP64(std::bit_cast<u64>(value)));
+    } else {
+        return value;
+    }
+}
+
+template <class T> inline void normalize(T *values, isize count)
+{
+    if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+        for (isize i = 0; i < count; i++) values[i] = swapBytes(values[i]);
+    }
+}
+
+template <class T> inline void readBulk(const u8 *& buf, T *values, isize count)
+{
+    static_assert(isBulkType<T>);
+    std::memcpy((void *)values, (const void *)buf, count * sizeof(T));
+    normalize(values, count);
+    buf += count * sizeof(T);
+}
+
+template <class T> inline void writeBulk(u8 *& buf, const T *values, isize count)
+{
+    static_assert(isBulkType<T>);
+    if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+        for (isize i = 0; i < count; i++) {
+            T value = swapBytes(values[i]);
+            std::memcpy((void *)(buf + i * sizeof(T)), (const void *)&value, sizeof(T));
+        }
+    } else {
+        std::memcpy((void *)buf, (const void *)values, count * sizeof(T));
+    }
+    buf += count * sizeof(T);
+}
+
+
 //
 // Counter (determines the state size)
 //
@@ -164,10 +220,21 @@ public:
         return *this;
     }
 
+    template <class T>
+    SerCounter& bulk(T *v, isize n)
+    {
+        if constexpr (isBulkType<T>) {
+            count += n * isizeof(T);
+        } else {
+            for (isize i = 0; i < n; ++i) *this << v[i];
+        }
+        return *this;
+    }
+
     template <class T, isize N>
     auto& operator<<(util::Array<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.elements << a.w;
         return *this;
     }
@@ -175,8 +242,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedArray<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.w;
         return *this;
     }
@@ -184,7 +251,7 @@ public:
     template <class T, isize N>
     auto& operator<<(util::RingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -192,8 +259,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedRingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -226,8 +293,12 @@ public:
     template <class T, isize N>
     SerCounter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        using E = std::remove_all_extents_t<T>;
+
+        if constexpr (isBulkType<E>) {
+            bulk((E *)v, isize(sizeof(v) / sizeof(E)));
+        } else {
+            for(isize i = 0; i < N; ++i) *this << v[i];
         }
         return *this;
     }
@@ -259,13 +330,48 @@ hash = util::fnvIt64(hash, (u64)v); \
 return *this; \
 }
 
+/* Memory blocks such as allocators or integer arrays are condensed into a
+ * single value by a hash tree (see HashTree.h). If a tree list is provided,
+ * the checker keeps all trees which enables diff() to locate the first
+ * diverging memory page.
+ */
 class SerChecker
 {
 public:
 
     u64 hash;
 
+    // Optional storage for the hash trees of all memory blocks
+    std::vector<util::HashTree> *trees = nullptr;
+
     SerChecker() { hash = util::fnvInit64(); }
+    SerChecker(std::vector<util::HashTree> &trees) : SerChecker() { this->trees = &trees; }
+
+    void block(const void *addr, isize size)
+    {
+        if (trees) {
+
+            trees->emplace_back((const u8 *)addr, size);
+            hash = util::fnvIt64(hash, trees->back().checksum());
+
+        } else {
+
+            hash = util::fnvIt64(hash, util::HashTree::hash((const u8 *)addr, size));
+        }
+    }
+
+    template <class T>
+    SerChecker& bulk(T *v, isize n)
+    {
+        // Memory blocks are hashed in their native format on little endian hosts
+        if constexpr (isBulkType<T> &&
+                      (sizeof(T) == 1 || std::endian::native == std::endian::little)) {
+            block((const void *)v, n * isizeof(T));
+        } else {
+            for (isize i = 0; i < n; i++) *this << v[i];
+        }
+        return *this;
+    }
 
     CHECK(const bool)
     CHECK(const char)
@@ -285,23 +391,23 @@ public:
     template <class T>
     auto& operator<<(util::Allocator<T> &a)
     {
-        hash = util::fnvIt64(hash, a.fnv64());
+        block((const void *)a.ptr, a.bytesize());
         return *this;
     }
 
     template <class T, isize N>
     auto& operator<<(util::Array<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        *this << a.elements << a.w;
+        bulk(a.elements, N);
+        *this << a.w;
         return *this;
     }
 
     template <class T, isize N>
     auto& operator<<(util::SortedArray<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.w;
         return *this;
     }
@@ -309,7 +415,7 @@ public:
     template <class T, isize N>
     auto& operator<<(util::RingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -317,8 +423,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedRingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -352,8 +458,12 @@ public:
     template <class T, isize N>
     SerChecker& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        using E = std::remove_all_extents_t<T>;
+
+        if constexpr (isBulkType<E>) {
+            bulk((E *)v, isize(sizeof(v) / sizeof(E)));
+        } else {
+            for(isize i = 0; i < N; ++i) *this << v[i];
         }
         return *this;
     }
@@ -423,10 +533,21 @@ public:
         return *this;
     }
 
+    template <class T>
+    SerReader& bulk(T *v, isize n)
+    {
+        if constexpr (isBulkType<T>) {
+            readBulk(ptr, v, n);
+        } else {
+            for (isize i = 0; i < n; ++i) *this << v[i];
+        }
+        return *this;
+    }
+
     template <class T, isize N>
     auto& operator<<(util::Array<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.elements << a.w;
         return *this;
     }
@@ -434,8 +555,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedArray<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.w;
         return *this;
     }
@@ -443,7 +564,7 @@ public:
     template <class T, isize N>
     auto& operator<<(util::RingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -451,8 +572,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedRingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -493,8 +614,12 @@ public:
     template <class T, isize N>
     SerReader& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        using E = std::remove_all_extents_t<T>;
+
+        if constexpr (isBulkType<E>) {
+            bulk((E *)v, isize(sizeof(v) / sizeof(E)));
+        } else {
+            for(isize i = 0; i < N; ++i) *this << v[i];
         }
         return *this;
     }
@@ -569,10 +694,21 @@ public:
         return *this;
     }
 
+    template <class T>
+    SerWriter& bulk(T *v, isize n)
+    {
+        if constexpr (isBulkType<T>) {
+            writeBulk(ptr, v, n);
+        } else {
+            for (isize i = 0; i < n; ++i) *this << v[i];
+        }
+        return *this;
+    }
+
     template <class T, isize N>
     auto& operator<<(util::Array<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.elements << a.w;
         return *this;
     }
@@ -580,8 +716,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedArray<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.w;
         return *this;
     }
@@ -589,7 +725,7 @@ public:
     template <class T, isize N>
     auto& operator<<(util::RingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
+        bulk(a.elements, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -597,8 +733,8 @@ public:
     template <class T, isize N>
     auto& operator<<(util::SortedRingBuffer<T, N> &a)
     {
-        for(isize i = 0; i < N; ++i) *this << a.elements[i];
-        for(isize i = 0; i < N; ++i) *this << a.keys[i];
+        bulk(a.elements, N);
+        bulk(a.keys, N);
         *this << a.r << a.w;
         return *this;
     }
@@ -632,8 +768,12 @@ public:
     template <class T, isize N>
     SerWriter& operator<<(T (&v)[N])
     {
-        for(isize i = 0; i < N; ++i) {
-            *this << v[i];
+        using E = std::remove_all_extents_t<T>;
+
+        if constexpr (isBulkType<E>) {
+            bulk((E *)v, isize(sizeof(v) / sizeof(E)));
+        } else {
+            for(isize i = 0; i < N; ++i) *this << v[i];
         }
         return *this;
     }
@@ -25,6 +25,15 @@ Thread::launch()
     assert(isLaunched());
 }
 
+void
+Thread::attach()
+{
+    assert(!isLaunched());
+
+    // From now on, the calling thread acts as the emulator thread
+    driver = std::this_thread::get_id();
+}
+
 void
 Thread::assertLaunched()
 {
@@ -79,6 +88,38 @@ Thread::execute()
     }
 }
 
+bool
+Thread::isEmulatorThread() const
+{
+    auto id = std::this_thread::get_id();
+    return id == thread.get_id() || id == driver;
+}
+
+bool
+Thread::step()
+{
+    assert(isEmulatorThread());
+
+    // Process all pending commands
+    update();
+
+    // Only proceed if the emulator is running
+    if (!isRunning()) return false;
+
+    try {
+
+        computeFrame();
+        frameCounter++;
+
+    } catch (StateChangeException &exc) {
+
+        // Interruption
+        switchState((ExecState)exc.data);
+    }
+
+    return true;
+}
+
 void
 Thread::sleep()
 {
@@ -354,8 +395,6 @@ Thread::trackOff(isize source)
 void
 Thread::changeStateTo(ExecState requestedState)
 {
-    assertLaunched();
-
     if (isEmulatorThread()) {
 
         // Switch immediately
@@ -364,6 +403,8 @@ Thread::changeStateTo(ExecState requestedState)
 
     } else {
 
+        assertLaunched();
+
         // Remember the requested state
         newState = requestedState;
 
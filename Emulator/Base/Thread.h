@@ -34,6 +34,9 @@ protected:
 
     // The thread object
     std::thread thread;
+
+    // The thread driving the emulator if no emulator thread is launched
+    std::thread::id driver;
     
     // The current thread state and a change request
     ExecState state = STATE_UNINIT;
@@ -84,6 +87,9 @@ protected:
     // Launches the emulator thread
     void launch();
 
+    // Lets the calling thread drive the emulator instead
+    void attach();
+
     // Sanity check
     void assertLaunched();
 
@@ -95,11 +101,14 @@ protected:
 public:
 
     // Returns true if this functions is called from within the emulator thread
-    bool isEmulatorThread() const { return std::this_thread::get_id() == thread.get_id(); }
+    bool isEmulatorThread() const;
 
     // Performs a state change
     void switchState(ExecState newState);
 
+    // Processes pending commands and computes a single frame (attached mode)
+    bool step();
+
 private:
 
     // Updates the emulator state (implemented by the subclass)
@@ -40,6 +40,7 @@ Agnus::operator << (SerResetter &worker)
 
     // Initialize statistical counters
     clearStats();
+    clearProfile();
 
     // Initialize all event slots
     for (isize i = 0; i < SLOT_COUNT; i++) {
@@ -222,9 +223,27 @@ Agnus::execute()
 }
 
 void
-Agnus::execute(DMACycle cycles)
+Agnus::advance(DMACycle cycles)
 {
-    for (DMACycle i = 0; i < cycles; i++) execute();
+    Cycle target = clock + DMA_CYCLES(cycles);
+
+    while (clock < target) {
+
+        /* Jump straight to the next trigger cycle or to the target cycle,
+         * whatever comes first. Line wraps don't need special treatment here,
+         * because the end of each line is marked by an event which resets
+         * the horizontal counter in the EOL handler.
+         */
+        Cycle next = std::min(target, std::max(nextTrigger, clock + DMA_CYCLES(1)));
+
+        // Advance the internal clock and the horizontal counter
+        pos.h += AS_DMA_CYCLES(next - clock);
+        clock = next;
+        assert(pos.h <= HPOS_CNT);
+
+        // Process pending events
+        if (nextTrigger <= clock) executeUntil(clock);
+    }
 }
 
 void
@@ -268,10 +287,13 @@ Agnus::syncWithEClock()
     assert(DMA_CYCLES(AS_DMA_CYCLES(clock + delay)) == clock + delay);
     
     // Execute Agnus until the target cycle has been reached
-    execute(AS_DMA_CYCLES(delay));
+    advance(AS_DMA_CYCLES(delay));
 
     // Add wait states to the CPU
     cpu.addWaitStates(delay);
+
+    // Record the lost cycles
+    stats.eClockSync += AS_CPU_CYCLES(delay);
 }
 
 void
@@ -292,6 +314,10 @@ Agnus::executeUntilBusIsFree()
         // Execute Agnus until the bus is free
         do {
 
+            // Charge the lost cycle to the current bus owner
+            stats.stalls[busOwner[pos.h]] += AS_CPU_CYCLES(DMA_CYCLES(1));
+            busStall[pos.h] = true;
+
             execute();
             if (++delay == 2) bls = true;
 
@@ -302,6 +328,9 @@ Agnus::executeUntilBusIsFree()
 
         // Add wait states to the CPU
         cpu.addWaitStates(DMA_CYCLES(delay));
+
+        // Record the lost cycles (profiling)
+        if constexpr (PROFILE_MEMORY) mem.profileWaitCycles(delay);
     }
 
     // Assign bus to the CPU
@@ -336,24 +365,31 @@ Agnus::executeUntil(Cycle cycle) {
     //
 
     if (isDue<SLOT_REG>(cycle)) {
+        EventTimer<SLOT_REG> timer(*this);
         agnus.serviceREGEvent(cycle);
     }
     if (isDue<SLOT_CIAA>(cycle)) {
+        EventTimer<SLOT_CIAA> timer(*this);
         ciaa.serviceEvent(id[SLOT_CIAA]);
     }
     if (isDue<SLOT_CIAB>(cycle)) {
+        EventTimer<SLOT_CIAB> timer(*this);
         ciab.serviceEvent(id[SLOT_CIAB]);
     }
     if (isDue<SLOT_BPL>(cycle)) {
+        EventTimer<SLOT_BPL> timer(*this);
         agnus.serviceBPLEvent(id[SLOT_BPL]);
     }
     if (isDue<SLOT_DAS>(cycle)) {
+        EventTimer<SLOT_DAS> timer(*this);
         agnus.serviceDASEvent(id[SLOT_DAS]);
     }
     if (isDue<SLOT_COP>(cycle)) {
+        EventTimer<SLOT_COP> timer(*this);
         copper.serviceEvent(id[SLOT_COP]);
     }
     if (isDue<SLOT_BLT>(cycle)) {
+        EventTimer<SLOT_BLT> timer(*this);
         blitter.serviceEvent(id[SLOT_BLT]);
     }
 
@@ -364,39 +400,51 @@ Agnus::executeUntil(Cycle cycle) {
         //
 
         if (isDue<SLOT_CH0>(cycle)) {
+            EventTimer<SLOT_CH0> timer(*this);
             paula.channel0.serviceEvent();
         }
         if (isDue<SLOT_CH1>(cycle)) {
+            EventTimer<SLOT_CH1> timer(*this);
             paula.channel1.serviceEvent();
         }
         if (isDue<SLOT_CH2>(cycle)) {
+            EventTimer<SLOT_CH2> timer(*this);
             paula.channel2.serviceEvent();
         }
         if (isDue<SLOT_CH3>(cycle)) {
+            EventTimer<SLOT_CH3> timer(*this);
             paula.channel3.serviceEvent();
         }
         if (isDue<SLOT_DSK>(cycle)) {
+            EventTimer<SLOT_DSK> timer(*this);
             paula.diskController.serviceDiskEvent();
         }
         if (isDue<SLOT_VBL>(cycle)) {
+            EventTimer<SLOT_VBL> timer(*this);
             agnus.serviceVBLEvent(id[SLOT_VBL]);
         }
         if (isDue<SLOT_IRQ>(cycle)) {
+            EventTimer<SLOT_IRQ> timer(*this);
             paula.serviceIrqEvent();
         }
         if (isDue<SLOT_KBD>(cycle)) {
+            EventTimer<SLOT_KBD> timer(*this);
             keyboard.serviceKeyboardEvent(id[SLOT_KBD]);
         }
         if (isDue<SLOT_TXD>(cycle)) {
+            EventTimer<SLOT_TXD> timer(*this);
             uart.serviceTxdEvent(id[SLOT_TXD]);
         }
         if (isDue<SLOT_RXD>(cycle)) {
+            EventTimer<SLOT_RXD> timer(*this);
             uart.serviceRxdEvent(id[SLOT_RXD]);
         }
         if (isDue<SLOT_POT>(cycle)) {
+            EventTimer<SLOT_POT> timer(*this);
             paula.servicePotEvent(id[SLOT_POT]);
         }
         if (isDue<SLOT_IPL>(cycle)) {
+            EventTimer<SLOT_IPL> timer(*this);
             paula.serviceIplEvent();
         }
         if (isDue<SLOT_TER>(cycle)) {
@@ -406,54 +454,71 @@ Agnus::executeUntil(Cycle cycle) {
             //
 
             if (isDue<SLOT_DC0>(cycle)) {
+                EventTimer<SLOT_DC0> timer(*this);
                 df0.serviceDiskChangeEvent <SLOT_DC0> ();
             }
             if (isDue<SLOT_DC1>(cycle)) {
+                EventTimer<SLOT_DC1> timer(*this);
                 df1.serviceDiskChangeEvent <SLOT_DC1> ();
             }
             if (isDue<SLOT_DC2>(cycle)) {
+                EventTimer<SLOT_DC2> timer(*this);
                 df2.serviceDiskChangeEvent <SLOT_DC2> ();
             }
             if (isDue<SLOT_DC3>(cycle)) {
+                EventTimer<SLOT_DC3> timer(*this);
                 df3.serviceDiskChangeEvent <SLOT_DC3> ();
             }
             if (isDue<SLOT_HD0>(cycle)) {
+                EventTimer<SLOT_HD0> timer(*this);
                 hd0.serviceHdrEvent <SLOT_HD0> ();
             }
             if (isDue<SLOT_HD1>(cycle)) {
+                EventTimer<SLOT_HD1> timer(*this);
                 hd1.serviceHdrEvent <SLOT_HD1> ();
             }
             if (isDue<SLOT_HD2>(cycle)) {
+                EventTimer<SLOT_HD2> timer(*this);
                 hd2.serviceHdrEvent <SLOT_HD2> ();
             }
             if (isDue<SLOT_HD3>(cycle)) {
+                EventTimer<SLOT_HD3> timer(*this);
                 hd3.serviceHdrEvent <SLOT_HD3> ();
             }
             if (isDue<SLOT_MSE1>(cycle)) {
+                EventTimer<SLOT_MSE1> timer(*this);
                 controlPort1.mouse.serviceMouseEvent <SLOT_MSE1> ();
             }
             if (isDue<SLOT_MSE2>(cycle)) {
+                EventTimer<SLOT_MSE2> timer(*this);
                 controlPort2.mouse.serviceMouseEvent <SLOT_MSE2> ();
             }
             if (isDue<SLOT_SNP>(cycle)) {
+                EventTimer<SLOT_SNP> timer(*this);
                 amiga.serviceSnpEvent(id[SLOT_KEY]);
             }
             if (isDue<SLOT_RSH>(cycle)) {
+                EventTimer<SLOT_RSH> timer(*this);
                 retroShell.serviceEvent();
             }
             if (isDue<SLOT_KEY>(cycle)) {
+                EventTimer<SLOT_KEY> timer(*this);
                 keyboard.serviceKeyEvent();
             }
             if (isDue<SLOT_SRV>(cycle)) {
+                EventTimer<SLOT_SRV> timer(*this);
                 remoteManager.serviceServerEvent();
             }
             if (isDue<SLOT_SER>(cycle)) {
+                EventTimer<SLOT_SER> timer(*this);
                 remoteManager.serServer.serviceSerEvent();
             }
             if (isDue<SLOT_ALA>(cycle)) {
+                EventTimer<SLOT_ALA> timer(*this);
                 amiga.serviceAlarmEvent();
             }
             if (isDue<SLOT_INS>(cycle)) {
+                EventTimer<SLOT_INS> timer(*this);
                 agnus.serviceINSEvent();
             }
 
@@ -639,6 +704,7 @@ Agnus::eolHandler()
 
     // Clear the bus usage table
     for (isize i = 0; i < HPOS_CNT; i++) busOwner[i] = BUS_NONE;
+    for (isize i = 0; i < HPOS_CNT; i++) busStall[i] = false;
 
     // Clear other variables
     for (isize i = 0; i < 8; i++) lastCtlWrite[i] = 0xFF;
@@ -18,6 +18,7 @@
 #include "DmaDebugger.h"
 #include "Sequencer.h"
 #include "Memory.h"
+#include "Chrono.h"
 
 namespace vamiga {
 
@@ -88,6 +89,13 @@ public:
     // An optional sync event to be processed in serviceRegEvent()
     EventID syncEvent = EVENT_NONE;
 
+    // Profiling data of all events (if PROFILE_EVENTS is set in config.h)
+    EventProfile eventProfile[SLOT_COUNT][BPL_EVENT_COUNT] = { };
+
+    // Start of the event profile (wall clock time and hardware counter)
+    util::Time profileStart = util::Time::now();
+    i64 profileStamp = util::Time::stamp();
+
     
     //
     // Counters
@@ -164,6 +172,9 @@ public:
     // Recorded DMA usage for all cycles in the current rasterline
     BusOwner busOwner[HPOS_CNT] = { };
 
+    // Recorded CPU wait states for all cycles in the current rasterline
+    bool busStall[HPOS_CNT] = { };
+
     // Remembers the last write to SPRxCTL (EXPERIMENTAL)
     u8 lastCtlWrite[8] = { };
 
@@ -402,6 +413,13 @@ public:
 public:
     
     void cacheInfo(AgnusInfo &result) const override;
+    void cacheStats(AgnusStats &result) const override;
+
+    // Returns the profiling data of a single event
+    const EventProfile &getEventProfile(EventSlot s, EventID id) const;
+
+    // Deletes all recorded profiling data
+    void clearProfile();
 
 private:
     
@@ -452,7 +470,7 @@ public:
     void execute();
 
     // Executes Agnus for a certain amount of cycles
-    void execute(DMACycle cycles);
+    void advance(DMACycle cycles);
     
     // Executes Agnus to the beginning of the next E clock cycle
     void syncWithEClock();
@@ -469,6 +487,45 @@ private:
     // Processes all events up to a given master cycle
     void executeUntil(Cycle cycle);
 
+    /* Measures the execution time of an event handler. The measurement starts
+     * when the object is created and ends when it goes out of scope. If event
+     * profiling is disabled in config.h, the object compiles to nothing.
+     */
+    template <EventSlot s> class EventTimer {
+
+        Agnus &agnus;
+        EventID id = EVENT_NONE;
+        i64 start = 0;
+
+    public:
+
+        EventTimer(Agnus &agnus) : agnus(agnus) {
+
+            if constexpr (PROFILE_EVENTS) {
+
+                id = agnus.id[s];
+                start = util::Time::stamp();
+            }
+        }
+
+        ~EventTimer() {
+
+            if constexpr (PROFILE_EVENTS) {
+
+                auto ticks = util::Time::stamp() - start;
+
+                agnus.stats.slotProfile[s].count++;
+                agnus.stats.slotProfile[s].ticks += ticks;
+
+                if (id < BPL_EVENT_COUNT) {
+
+                    agnus.eventProfile[s][id].count++;
+                    agnus.eventProfile[s][id].ticks += ticks;
+                }
+            }
+        }
+    };
+
     // Executes the first sprite DMA cycle
     template <isize nr> void executeFirstSpriteCycle();
 
@@ -297,7 +297,8 @@ Agnus::serviceREGEvent(Cycle until)
         }
     }
 
-    // Schedule next event
+    // Park the slot and schedule the next register change (if any)
+    trigger[SLOT_REG] = NEVER;
     scheduleNextREGEvent();
 }
 
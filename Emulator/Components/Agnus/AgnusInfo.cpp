@@ -595,6 +595,53 @@ Agnus::_dump(Category category, std::ostream& os) const
         }
     }
     
+    if (category == Category::Stats && !PROFILE_EVENTS) {
+
+        os << "Event profiling is disabled (see PROFILE_EVENTS in config.h)" << std::endl;
+    }
+
+    if (category == Category::Stats && PROFILE_EVENTS) {
+
+        auto &stats = getStats();
+
+        // Converts timer ticks to nanoseconds
+        auto ns = [&](double ticks) {
+            return stats.ticksPerSecond > 0 ? ticks * 1000000000.0 / stats.ticksPerSecond : 0.0;
+        };
+
+        auto line = [&](const string &name, const EventProfile &profile) {
+
+            auto share = stats.profileTicks ? 100.0 * profile.ticks / stats.profileTicks : 0.0;
+
+            os << std::left << std::setw(24) << name;
+            os << std::right << std::setw(12) << profile.count;
+            os << std::right << std::setw(12) << std::fixed << std::setprecision(2) << ns(double(profile.ticks)) / 1000000.0;
+            os << std::right << std::setw(9) << std::setprecision(2) << share << "%";
+            os << std::right << std::setw(10) << std::setprecision(1) << ns(double(profile.ticks) / profile.count);
+            os << std::endl;
+        };
+
+        os << std::setfill(' ') << std::left << std::setw(24) << "Slot / Event";
+        os << std::right << std::setw(12) << "Count";
+        os << std::right << std::setw(12) << "Time (ms)";
+        os << std::right << std::setw(10) << "Share";
+        os << std::right << std::setw(10) << "Avg (ns)" << std::endl;
+
+        for (isize i = 0; i < SLOT_COUNT; i++) {
+
+            if (stats.slotProfile[i].count == 0) continue;
+
+            line(EventSlotEnum::key(i), stats.slotProfile[i]);
+
+            for (isize j = 0; j < BPL_EVENT_COUNT; j++) {
+
+                if (eventProfile[i][j].count == 0) continue;
+                line("  " + string(eventName(EventSlot(i), EventID(j))), eventProfile[i][j]);
+            }
+        }
+        os << std::defaultfloat;
+    }
+
     if (category == Category::Dma) {
         
         sequencer.dump(Category::Dma, os);
@@ -668,6 +715,39 @@ Agnus::cacheInfo(AgnusInfo &info) const
     }
 }
 
+void
+Agnus::cacheStats(AgnusStats &result) const
+{
+    // Determine the rate of the profiling timer
+    auto ticks = util::Time::stamp() - profileStamp;
+    auto elapsed = (util::Time::now() - profileStart).asNanoseconds();
+
+    result.profileTicks = ticks;
+    result.ticksPerSecond = elapsed > 0 ? ticks * 1000000000.0 / elapsed : 0.0;
+}
+
+const EventProfile &
+Agnus::getEventProfile(EventSlot s, EventID id) const
+{
+    static const EventProfile none = { };
+
+    assert_enum(EventSlot, s);
+    return id >= 0 && id < BPL_EVENT_COUNT ? eventProfile[s][id] : none;
+}
+
+void
+Agnus::clearProfile()
+{
+    for (isize i = 0; i < SLOT_COUNT; i++) {
+
+        stats.slotProfile[i] = { };
+        for (isize j = 0; j < BPL_EVENT_COUNT; j++) eventProfile[i][j] = { };
+    }
+
+    profileStart = util::Time::now();
+    profileStamp = util::Time::stamp();
+}
+
 void
 Agnus::updateStats()
 {
@@ -709,6 +789,26 @@ Agnus::updateStats()
     stats.bitplaneActivity = w * stats.bitplaneActivity + (1 - w) * bitplaneUsage;
     
     for (isize i = 0; i < BUS_COUNT; i++) stats.usage[i] = 0;
+
+    // Summarize the CPU cycles lost in the previous frame
+    stats.copperStalls = stats.stalls[BUS_COPPER];
+    stats.blitterStalls = stats.stalls[BUS_BLITTER];
+    stats.diskStalls = stats.stalls[BUS_DISK];
+    stats.refreshStalls = stats.stalls[BUS_REFRESH];
+    stats.blockedStalls = stats.stalls[BUS_BLOCKED];
+    stats.eClockStalls = stats.eClockSync;
+
+    stats.audioStalls = 0;
+    for (isize i = BUS_AUD0; i <= BUS_AUD3; i++) stats.audioStalls += stats.stalls[i];
+
+    stats.spriteStalls = 0;
+    for (isize i = BUS_SPRITE0; i <= BUS_SPRITE7; i++) stats.spriteStalls += stats.stalls[i];
+
+    stats.bitplaneStalls = 0;
+    for (isize i = BUS_BPL1; i <= BUS_BPL6; i++) stats.bitplaneStalls += stats.stalls[i];
+
+    for (isize i = 0; i < BUS_COUNT; i++) stats.stalls[i] = 0;
+    stats.eClockSync = 0;
 }
 
 }
@@ -535,6 +535,13 @@ typedef struct
 }
 AgnusInfo;
 
+typedef struct
+{
+    i64 count;
+    i64 ticks;
+}
+EventProfile;
+
 typedef struct
 {
     isize usage[BUS_COUNT];
@@ -545,5 +552,25 @@ typedef struct
     double audioActivity;
     double spriteActivity;
     double bitplaneActivity;
+
+    // CPU cycles lost to bus contention in the current frame (raw counters)
+    isize stalls[BUS_COUNT];
+    isize eClockSync;
+
+    // CPU cycles lost to bus contention in the previous frame
+    isize copperStalls;
+    isize blitterStalls;
+    isize diskStalls;
+    isize audioStalls;
+    isize spriteStalls;
+    isize bitplaneStalls;
+    isize refreshStalls;
+    isize blockedStalls;    // Reserved cycles without a DMA transfer
+    isize eClockStalls;
+
+    // Event profile (only recorded if PROFILE_EVENTS is set in config.h)
+    EventProfile slotProfile[SLOT_COUNT];
+    i64 profileTicks;
+    double ticksPerSecond;
 }
 AgnusStats;
@@ -548,7 +548,7 @@ Blitter::beginBlit()
 void
 Blitter::beginLineBlit(isize level)
 {
-    static u64 verbose = 0;
+    static thread_local u64 verbose = 0;
 
     if (verbose++ == 0) {
         debug(BLT_CHECKSUM, "Performing level %ld line blits.\n", level);
@@ -574,7 +574,7 @@ Blitter::beginLineBlit(isize level)
 void
 Blitter::beginCopyBlit(isize level)
 {
-    static u64 verbose = 0;
+    static thread_local u64 verbose = 0;
 
     if (verbose++ == 0) {
         debug(BLT_CHECKSUM, "Performing level %ld copy blits.\n", level);
@@ -290,6 +290,7 @@ DmaDebugger::setColor(BusOwner owner, u32 rgba)
     debugColor[owner][1] = color.shade(0.1);
     debugColor[owner][2] = color.tint(0.1);
     debugColor[owner][3] = color.tint(0.3);
+    debugColor[owner][4] = color.tint(0.6);
 }
 
 void
@@ -301,6 +302,7 @@ DmaDebugger::eolHandler()
     // Copy Agnus arrays before they get deleted
     std::memcpy(busValue, agnus.busValue, sizeof(agnus.busValue));
     std::memcpy(busOwner, agnus.busOwner, sizeof(agnus.busOwner));
+    std::memcpy(busStall, agnus.busStall, sizeof(agnus.busStall));
 
     // Record some information for being picked up in the HSYNC handler
     pixel0 = agnus.pos.pixel(0);
@@ -316,15 +318,15 @@ DmaDebugger::hsyncHandler(isize vpos)
 
     // Draw first chunk (data from previous DMA line)
     auto *ptr1 = pixelEngine.workingPtr(vpos);
-    computeOverlay(ptr1, HBLANK_MIN, HPOS_MAX, busOwner, busValue);
+    computeOverlay(ptr1, HBLANK_MIN, HPOS_MAX, busOwner, busValue, busStall);
 
     // Draw second chunk (data from current DMA line)
     auto *ptr2 = ptr1 + agnus.pos.pixel(0);
-    computeOverlay(ptr2, 0, HBLANK_MIN - 1, agnus.busOwner, agnus.busValue);
+    computeOverlay(ptr2, 0, HBLANK_MIN - 1, agnus.busOwner, agnus.busValue, agnus.busStall);
 }
 
 void
-DmaDebugger::computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own, u16 *val)
+DmaDebugger::computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own, u16 *val, bool *stall)
 {
     double opacity = config.opacity / 100.0;
     double bgWeight = 0;
@@ -370,6 +372,7 @@ DmaDebugger::computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own,
                 ptr[2] = TEXEL(GpuColor(ptr[2]).shade(bgWeight).rawValue);
                 ptr[3] = TEXEL(GpuColor(ptr[3]).shade(bgWeight).rawValue);
             }
+            markStall(ptr, stall[i]);
             continue;
         }
 
@@ -391,6 +394,17 @@ DmaDebugger::computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own,
         ptr[1] = TEXEL(col1.rawValue);
         ptr[2] = TEXEL(col2.rawValue);
         ptr[3] = TEXEL(col3.rawValue);
+        markStall(ptr, stall[i]);
+    }
+}
+
+void
+DmaDebugger::markStall(Texel *ptr, bool stall)
+{
+    // Highlight the second half of the cycle if the CPU had to wait
+    if (stall && visualize[BUS_CPU]) {
+
+        ptr[2] = ptr[3] = TEXEL(GpuColor(debugColor[BUS_CPU][4]).rawValue);
     }
 }
 
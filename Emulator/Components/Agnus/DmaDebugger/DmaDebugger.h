@@ -65,6 +65,9 @@ class DmaDebugger : public SubComponent, public Inspectable<DmaDebuggerInfo> {
     // A local copy of the bus owner table (recorded in the EOL handler)
     BusOwner busOwner[HPOS_CNT];
 
+    // A local copy of the bus stall table (recorded in the EOL handler)
+    bool busStall[HPOS_CNT];
+
     // HSYNC handler information (recorded in the EOL handler)
     isize pixel0 = 0;
 
@@ -148,7 +151,10 @@ public:
 private:
 
     // Visualizes DMA usage for a certain range of DMA cycles
-    void computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own, u16 *val);
+    void computeOverlay(Texel *ptr, isize first, isize last, BusOwner *own, u16 *val, bool *stall);
+
+    // Highlights a cycle in which the CPU had to wait for the bus
+    void markStall(Texel *ptr, bool stall);
 };
 
 }
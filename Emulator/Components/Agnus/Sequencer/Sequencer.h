@@ -251,6 +251,7 @@ public:
 private:
     
     void initDasEventTable();
+    static void buildDasEventTable();
 
 
     //
@@ -9,6 +9,7 @@
 
 #include "config.h"
 #include "Sequencer.h"
+#include <mutex>
 
 namespace vamiga {
 
@@ -16,6 +17,14 @@ EventID Sequencer::dasDMA[64][HPOS_CNT];
 
 void
 Sequencer::initDasEventTable()
+{
+    // The table is shared by all emulator instances and set up only once
+    static std::once_flag flag;
+    std::call_once(flag, buildDasEventTable);
+}
+
+void
+Sequencer::buildDasEventTable()
 {
     std::memset(dasDMA, 0, sizeof(dasDMA));
 
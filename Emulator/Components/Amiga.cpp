@@ -162,6 +162,16 @@ Amiga::_didReset(bool hard)
 
     // Clear all runloop flags
     flags = 0;
+
+    // Discard all rewind points
+    if (hard) rewindBuffer.clear();
+}
+
+void
+Amiga::_didLoad()
+{
+    // Realign the snapshot events with the restored clock
+    scheduleNextSnpEvent();
 }
 
 i64
@@ -176,6 +186,9 @@ Amiga::getOption(Option option) const
         case OPT_AMIGA_SPEED_BOOST:     return config.timeLapse;
         case OPT_AMIGA_SNAPSHOTS:       return config.snapshots;
         case OPT_AMIGA_SNAPSHOT_DELAY:  return config.snapshotDelay;
+        case OPT_AMIGA_SNAPSHOT_EMBED:  return config.snapshotEmbed;
+        case OPT_AMIGA_REWIND_INTERVAL: return config.rewindInterval;
+        case OPT_AMIGA_REWIND_BUDGET:   return config.rewindBudget;
         case OPT_AMIGA_RUN_AHEAD:       return config.runAhead;
 
         default:
@@ -228,6 +241,24 @@ Amiga::checkOption(Option opt, i64 value)
             }
             return;
 
+        case OPT_AMIGA_SNAPSHOT_EMBED:
+
+            return;
+
+        case OPT_AMIGA_REWIND_INTERVAL:
+
+            if (value < 0 || value > 3000) {
+                throw Error(ERROR_OPT_INV_ARG, "0...3000");
+            }
+            return;
+
+        case OPT_AMIGA_REWIND_BUDGET:
+
+            if (value < 1 || value > 4096) {
+                throw Error(ERROR_OPT_INV_ARG, "1...4096");
+            }
+            return;
+
         case OPT_AMIGA_RUN_AHEAD:
 
             if (value < 0 || value > 12) {
@@ -286,6 +317,23 @@ Amiga::setOption(Option option, i64 value)
             scheduleNextSnpEvent();
             return;
 
+        case OPT_AMIGA_SNAPSHOT_EMBED:
+
+            config.snapshotEmbed = bool(value);
+            return;
+
+        case OPT_AMIGA_REWIND_INTERVAL:
+
+            config.rewindInterval = isize(value);
+            if (value == 0) rewindBuffer.clear();
+            scheduleNextSnpEvent();
+            return;
+
+        case OPT_AMIGA_REWIND_BUDGET:
+
+            config.rewindBudget = isize(value);
+            return;
+
         case OPT_AMIGA_RUN_AHEAD:
 
             config.runAhead = isize(value);
@@ -523,8 +571,7 @@ Amiga::_powerOn()
     // Start from a snapshot if requested
     if (string(INITIAL_SNAPSHOT) != "") {
 
-        Snapshot snapshot(INITIAL_SNAPSHOT);
-        loadSnapshot(snapshot);
+        loadSnapshot(std::filesystem::path(INITIAL_SNAPSHOT));
     }
 
     // Set initial breakpoints
@@ -640,18 +687,26 @@ Amiga::computeFrame()
         if (flags) {
 
             // Are we requested to take a snapshot?
-            /*
             if (flags & RL::AUTO_SNAPSHOT) {
                 clearFlag(RL::AUTO_SNAPSHOT);
-                takeAutoSnapshot();
+
+                // Take snapshot and hand it over to GUI
+                msgQueue.put(MSG_SNAPSHOT_TAKEN, SnapshotMsg { .snapshot = new Snapshot(*this) } );
             }
 
+            /*
             if (flags & RL::USER_SNAPSHOT) {
                 clearFlag(RL::USER_SNAPSHOT);
                 takeUserSnapshot();
             }
             */
 
+            // Are we requested to record a rewind point?
+            if (flags & RL::REWIND_POINT) {
+                clearFlag(RL::REWIND_POINT);
+                rewindBuffer.record(MB(emulator.get(OPT_AMIGA_REWIND_BUDGET)));
+            }
+
             // Did we reach a soft breakpoint?
             if (flags & RL::SOFTSTOP_REACHED) {
                 clearFlag(RL::SOFTSTOP_REACHED);
@@ -729,12 +784,25 @@ Amiga::computeFrame()
 }
 
 void
-Amiga::fastForward(isize frames)
+Amiga::fastForward(isize frames, bool video)
 {
     auto target = agnus.pos.frame + frames;
 
-    // Execute until the target frame has been reached
-    while (agnus.pos.frame < target) computeFrame();
+    // Suppress video output if requested
+    denise.noVideo = !video;
+
+    try {
+
+        // Execute until the target frame has been reached
+        while (agnus.pos.frame < target) computeFrame();
+
+    } catch (...) {
+
+        denise.noVideo = false;
+        throw;
+    }
+
+    denise.noVideo = false;
 }
 
 void
@@ -852,15 +920,33 @@ Amiga::takeSnapshot()
 void
 Amiga::serviceSnpEvent(EventID eventId)
 {
-    // Check for the main instance (ignore the run-ahead instance)
-    if (objid == 0) {
+    auto delay = emulator.get(OPT_AMIGA_SNAPSHOT_DELAY);
+    auto interval = emulator.get(OPT_AMIGA_REWIND_INTERVAL);
+
+    /* The state is saved at the next instruction boundary, because the CPU
+     * might be in the middle of executing an instruction at this point.
+     */
+
+    // Is it time to take an auto-snapshot?
+    if (agnus.clock >= nextSnapshot) {
 
-        // Take snapshot and hand it over to GUI
-        msgQueue.put(MSG_SNAPSHOT_TAKEN, SnapshotMsg { .snapshot = new Snapshot(*this) } );
+        // Check for the main instance (ignore the run-ahead instance)
+        if (objid == 0) signalAutoSnapshot();
+
+        nextSnapshot = agnus.clock + SEC(double(delay));
+    }
+
+    // Is it time to record a rewind point?
+    if (agnus.clock >= nextRewindPoint) {
+
+        // Check for the main instance (ignore the run-ahead instance)
+        if (objid == 0) signalRewindPoint();
+
+        nextRewindPoint = agnus.clock + DMA_CYCLES(agnus.pos.cyclesPerFrames(interval));
     }
 
     // Schedule the next event
-    scheduleNextSnpEvent();
+    scheduleSnpEvent();
 }
 
 void
@@ -868,9 +954,22 @@ Amiga::scheduleNextSnpEvent()
 {
     auto snapshots = emulator.get(OPT_AMIGA_SNAPSHOTS);
     auto delay = emulator.get(OPT_AMIGA_SNAPSHOT_DELAY);
+    auto interval = emulator.get(OPT_AMIGA_REWIND_INTERVAL);
+
+    nextSnapshot = snapshots ? agnus.clock + SEC(double(delay)) : NEVER;
+    nextRewindPoint = interval ? agnus.clock + DMA_CYCLES(agnus.pos.cyclesPerFrames(interval)) : NEVER;
+
+    scheduleSnpEvent();
+}
 
-    if (snapshots) {
-        agnus.scheduleRel<SLOT_SNP>(SEC(double(delay)), SNP_TAKE);
+void
+Amiga::scheduleSnpEvent()
+{
+    // Auto-snapshots and rewind points share the same event slot
+    auto trigger = std::min(nextSnapshot, nextRewindPoint);
+
+    if (trigger != NEVER) {
+        agnus.scheduleAbs<SLOT_SNP>(trigger, SNP_TAKE);
     } else {
         agnus.cancel<SLOT_SNP>();
     }
@@ -927,15 +1026,10 @@ Amiga::latestUserSnapshot()
 void 
 Amiga::loadSnapshot(const MediaFile &file)
 {
-    try {
-
-        const Snapshot &snapshot = dynamic_cast<const Snapshot &>(file);
-        loadSnapshot(snapshot);
-
-    } catch (...) {
+    auto snapshot = dynamic_cast<const Snapshot *>(&file);
+    if (!snapshot) throw Error(ERROR_FILE_TYPE_MISMATCH);
 
-        throw Error(ERROR_FILE_TYPE_MISMATCH);
-    }
+    loadSnapshot(*snapshot);
 }
 
 void
@@ -946,7 +1040,10 @@ Amiga::loadSnapshot(const Snapshot &snapshot)
         try {
 
             // Restore the saved state
-            load(snapshot.getData());
+            snapshot.restore(*this);
+
+            // Rewind points belong to the previous timeline
+            rewindBuffer.clear();
 
         } catch (Error &error) {
 
@@ -966,6 +1063,67 @@ Amiga::loadSnapshot(const Snapshot &snapshot)
     msgQueue.put(MSG_VIDEO_FORMAT, agnus.isPAL() ? PAL : NTSC);
 }
 
+void
+Amiga::loadSnapshot(const std::filesystem::path &path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream.is_open()) throw Error(ERROR_FILE_NOT_FOUND, path);
+
+    {   SUSPENDED
+
+        try {
+
+            // Restore the saved state chunk by chunk
+            Snapshot::restore(*this, stream);
+
+            // Rewind points belong to the previous timeline
+            rewindBuffer.clear();
+
+        } catch (Error &error) {
+
+            // Eliminate the inconsistency (see above)
+            hardReset();
+            throw error;
+        }
+    }
+
+    // Inform the GUI
+    msgQueue.put(MSG_SNAPSHOT_RESTORED);
+    msgQueue.put(MSG_VIDEO_FORMAT, agnus.isPAL() ? PAL : NTSC);
+}
+
+void
+Amiga::rewind(isize frames)
+{
+    {   SUSPENDED
+
+        auto target = agnus.pos.frame - frames;
+        if (!rewindBuffer.covers(target)) throw Error(ERROR_SNAP_NO_REWIND_POINT);
+
+        try {
+
+            // Restore the newest state that has been recorded before
+            auto frame = rewindBuffer.restore(target);
+
+            // Emulate up to the beginning of the target frame
+            fastForward(target - frame);
+
+        } catch (Error &error) {
+
+            // Eliminate the inconsistency (see above)
+            hardReset();
+            throw error;
+
+        } catch (StateChangeException &) {
+
+            // A breakpoint has been hit while catching up with the target frame
+        }
+    }
+
+    // Inform the GUI
+    msgQueue.put(MSG_SNAPSHOT_RESTORED);
+}
+
 /*
 void
 Amiga::takeAutoSnapshot()
@@ -40,6 +40,7 @@
 #include "Host.h"
 #include "OSDebugger.h"
 #include "RegressionTester.h"
+#include "RewindBuffer.h"
 #include "RemoteManager.h"
 #include "RetroShell.h"
 #include "RshServer.h"
@@ -73,6 +74,9 @@ class Amiga final : public CoreComponent, public Inspectable<AmigaInfo> {
         OPT_AMIGA_SPEED_BOOST,
         OPT_AMIGA_SNAPSHOTS,
         OPT_AMIGA_SNAPSHOT_DELAY,
+        OPT_AMIGA_SNAPSHOT_EMBED,
+        OPT_AMIGA_REWIND_INTERVAL,
+        OPT_AMIGA_REWIND_BUDGET,
         OPT_AMIGA_RUN_AHEAD
     };
     
@@ -167,6 +171,13 @@ private:
     typedef struct { Cycle trigger; i64 payload; } Alarm;
     std::vector<Alarm> alarms;
 
+    // Recorded states for rewinding the emulator
+    RewindBuffer rewindBuffer = RewindBuffer(*this);
+
+    // Trigger cycles of the next auto-snapshot and the next rewind point
+    Cycle nextSnapshot = NEVER;
+    Cycle nextRewindPoint = NEVER;
+
 
     //
     // Static methods
@@ -236,6 +247,8 @@ public:
 
         CLONE(flags)
         CLONE(config)
+        CLONE(nextSnapshot)
+        CLONE(nextRewindPoint)
 
         return *this;
     }
@@ -264,6 +277,7 @@ public:
 
     void _willReset(bool hard) override;
     void _didReset(bool hard) override;
+    void _didLoad() override;
     isize load(const u8 *buffer) override;
     isize save(u8 *buffer) override;
 
@@ -387,8 +401,11 @@ public:
 
     void computeFrame();
 
-    // Fast-forward the run-ahead instance
-    void fastForward(isize frames);
+    /* Emulates the specified number of frames. If video is false, the frames
+     * are computed without producing any video output, e.g., to fast-forward
+     * the run-ahead instance.
+     */
+    void fastForward(isize frames, bool video = true);
 
 
     //
@@ -407,6 +424,7 @@ public:
     void signalStop() { setFlag(RL::STOP); }
     void signalAutoSnapshot() { setFlag(RL::AUTO_SNAPSHOT); }
     void signalUserSnapshot() { setFlag(RL::USER_SNAPSHOT); }
+    void signalRewindPoint() { setFlag(RL::REWIND_POINT); }
 
 #if 0
     // Runs or pauses the emulator
@@ -439,6 +457,10 @@ public:
     // Loads the current state from a snapshot file
     void loadSnapshot(const MediaFile &file) throws;
     void loadSnapshot(const class Snapshot &snapshot) throws;
+    void loadSnapshot(const std::filesystem::path &path) throws;
+
+    // Reverts to the state the emulator was in the specified number of frames ago
+    void rewind(isize frames) throws;
 
     // Services a snapshot event
     void serviceSnpEvent(EventID id);
@@ -447,6 +469,7 @@ private:
 
     // Schedules the next snapshot event
     void scheduleNextSnpEvent();
+    void scheduleSnpEvent();
 
 
     //
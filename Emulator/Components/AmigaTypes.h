@@ -298,6 +298,15 @@ typedef struct
     //! Delay between two auto-snapshots in seconds
     isize snapshotDelay;
 
+    //! Embed unmodified disk images in snapshots (or reference them by hash)
+    bool snapshotEmbed;
+
+    //! Number of frames between two rewind points (0 = rewinding is disabled)
+    isize rewindInterval;
+
+    //! Memory reserved for rewind points in MB
+    isize rewindBudget;
+
     //! Number of run-ahead frames (0 = run-ahead is disabled)
     isize runAhead;
 }
@@ -337,6 +346,7 @@ constexpr u32 COPPERWP_REACHED   = (1 << 7);
 constexpr u32 AUTO_SNAPSHOT      = (1 << 8);
 constexpr u32 USER_SNAPSHOT      = (1 << 9);
 constexpr u32 SYNC_THREAD        = (1 << 10);
+constexpr u32 REWIND_POINT       = (1 << 11);
 };
 
 #endif
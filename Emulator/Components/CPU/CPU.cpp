@@ -28,13 +28,16 @@ Moira::sync(int cycles)
 {
     CPU *cpu = (CPU *)this;
 
+    // Catch up if decoupled overclocking has been switched off
+    if (cpu->lag && !(cpu->config.overclocking && cpu->config.decoupled)) cpu->catchUp();
+
     if (!cpu->config.overclocking) {
 
         // Advance the CPU clock
         clock += cycles;
 
         // Emulate Agnus up to the same cycle
-        agnus.execute(CPU_AS_DMA_CYCLES(cycles));
+        agnus.advance(CPU_AS_DMA_CYCLES(cycles));
 
     } else {
 
@@ -52,15 +55,31 @@ Moira::sync(int cycles)
         // Execute all other cycles
         cpu->debt += cycles;
 
-        while (cpu->debt >= microCyclesPerCycle) {
+        if (cpu->config.decoupled) {
+
+            /* Advance the CPU clock without emulating Agnus. Agnus catches up
+             * when the CPU accesses the chip bus or if the lag grows too large.
+             * The latter limits the delay of pending interrupts.
+             */
+            auto elapsed = cpu->debt / microCyclesPerCycle;
+            clock += 2 * elapsed;
+            cpu->debt -= elapsed * microCyclesPerCycle;
+            cpu->lag += elapsed;
+
+            if (cpu->lag >= CPU::maxLag) cpu->catchUp();
+
+        } else {
+
+            while (cpu->debt >= microCyclesPerCycle) {
 
-            // Advance the CPU clock by one DMA cycle
-            clock += 2;
+                // Advance the CPU clock by one DMA cycle
+                clock += 2;
 
-            // Emulate Agnus for one DMA cycle
-            agnus.execute();
+                // Emulate Agnus for one DMA cycle
+                agnus.execute();
 
-            cpu->debt -= microCyclesPerCycle;
+                cpu->debt -= microCyclesPerCycle;
+            }
         }
     }
 }
@@ -80,6 +99,13 @@ Moira::read16(u32 addr) const
 u16
 Moira::read16Dasm(u32 addr) const
 {
+    const CPU *cpu = (const CPU *)this;
+
+    // When decoding a trace, take the instruction words from the trace file
+    if (auto offset = (addr - cpu->dasmOverlayAddr) / 2; offset < cpu->dasmOverlay.size()) {
+        return cpu->dasmOverlay[offset];
+    }
+
     auto result = mem.spypeek16<ACCESSOR_CPU>(addr);
     
     // For LINE-A instructions, check if the opcode is a software trap
@@ -88,6 +114,27 @@ Moira::read16Dasm(u32 addr) const
     return result;
 }
 
+bool
+Moira::isCacheable(u32 addr) const
+{
+    // Only cache memory that can't be modified by DMA
+    if (addr > 0xFFFFFF) return false;
+
+    switch (mem.cpuMemSrc[addr >> 16]) {
+
+        case MEM_FAST:
+        case MEM_ROM:
+        case MEM_ROM_MIRROR:
+        case MEM_EXT:
+
+            return true;
+
+        default:
+
+            return false;
+    }
+}
+
 u16
 Moira::read16OnReset(u32 addr) const
 {
@@ -167,6 +214,19 @@ Moira::didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode)
     }
 }
 
+void
+Moira::recordInstruction()
+{
+    CPU *cpu = (CPU *)this;
+
+    // The flag may have been restored from a snapshot taken while tracing
+    if (cpu->tracer.isRecording()) {
+        cpu->tracer.record();
+    } else {
+        flags &= ~CPU_RECORD_INSTRUCTION;
+    }
+}
+
 void
 Moira::willExecute(ExceptionType exc, u16 vector)
 {
@@ -230,7 +290,7 @@ Moira::didJumpToVector(int nr, u32 addr)
 void
 Moira::didChangeCACR(u32 value)
 {
-
+    flushInstrCache();
 }
 
 void
@@ -293,6 +353,8 @@ CPU::getOption(Option option) const
         case OPT_CPU_DASM_SYNTAX:   return (long)config.dasmSyntax;
         case OPT_CPU_OVERCLOCKING:  return (long)config.overclocking;
         case OPT_CPU_RESET_VAL:     return (long)config.regResetVal;
+        case OPT_CPU_INSTR_CACHE:   return (long)config.instrCache;
+        case OPT_CPU_DECOUPLED:     return (long)config.decoupled;
 
         default:
             fatalError;
@@ -327,6 +389,8 @@ CPU::checkOption(Option opt, i64 value)
 
         case OPT_CPU_OVERCLOCKING:
         case OPT_CPU_RESET_VAL:
+        case OPT_CPU_INSTR_CACHE:
+        case OPT_CPU_DECOUPLED:
 
             return;
 
@@ -373,6 +437,17 @@ CPU::setOption(Option option, i64 value)
             config.regResetVal = u32(value);
             return;
 
+        case OPT_CPU_INSTR_CACHE:
+
+            config.instrCache = bool(value);
+            setInstrCache(config.instrCache);
+            return;
+
+        case OPT_CPU_DECOUPLED:
+
+            config.decoupled = bool(value);
+            return;
+
         default:
             fatalError;
     }
@@ -392,6 +467,12 @@ CPU::_didReset(bool hard)
         
         // Remove all previously recorded instructions
         debugger.clearLog();
+
+        // Discard all cached instruction words
+        flushInstrCache();
+
+        // Keep on tracing if a recording is in progress
+        if (tracer.isRecording()) flags |= moira::CPU_RECORD_INSTRUCTION;
         
     } else {
         
@@ -523,6 +604,7 @@ CPU::_dump(Category category, std::ostream& os) const
             if (flags & moira::CPU_CHECK_BP) os << util::tab("") << "CPU_CHECK_BP" << std::endl;
             if (flags & moira::CPU_CHECK_WP) os << util::tab("") << "CPU_CHECK_WP" << std::endl;
             if (flags & moira::CPU_CHECK_CP) os << util::tab("") << "CPU_CHECK_CP" << std::endl;
+            if (flags & moira::CPU_RECORD_INSTRUCTION) os << util::tab("") << "CPU_RECORD_INSTRUCTION" << std::endl;
             os << std::endl;
         }
 
@@ -623,11 +705,20 @@ CPU::_didLoad()
      */
     debugger.breakpoints.setNeedsCheck(debugger.breakpoints.elements() != 0);
     debugger.watchpoints.setNeedsCheck(debugger.watchpoints.elements() != 0);
+
+    // The same holds for the trace recorder
+    if (tracer.isRecording()) {
+        flags |= moira::CPU_RECORD_INSTRUCTION;
+    } else {
+        flags &= ~moira::CPU_RECORD_INSTRUCTION;
+    }
 }
 
 void
 CPU::resyncOverclockedCpu()
 {
+    catchUp();
+
     if (debt) {
 
         clock += 2;
@@ -636,6 +727,16 @@ CPU::resyncOverclockedCpu()
     }
 }
 
+void
+CPU::catchUp()
+{
+    if (lag) {
+
+        agnus.advance(lag);
+        lag = 0;
+    }
+}
+
 const char *
 CPU::disassembleRecordedInstr(isize i, isize *len)
 {
@@ -650,7 +751,7 @@ CPU::disassembleRecordedWords(isize i, isize len)
 const char *
 CPU::disassembleRecordedFlags(isize i)
 {
-    static char result[18];
+    static thread_local char result[18];
     
     disassembleSR(result, debugger.logEntryAbs((int)i).sr);
     return result;
@@ -659,7 +760,7 @@ CPU::disassembleRecordedFlags(isize i)
 const char *
 CPU::disassembleRecordedPC(isize i)
 {
-    static char result[16];
+    static thread_local char result[16];
 
     Moira::dump24(result, debugger.logEntryAbs((int)i).pc0);
     return result;
@@ -668,7 +769,7 @@ CPU::disassembleRecordedPC(isize i)
 const char *
 CPU::disassembleAddr(u32 addr)
 {
-    static char result[16];
+    static thread_local char result[16];
 
     Moira::dump24(result, addr);
     return result;
@@ -677,7 +778,7 @@ CPU::disassembleAddr(u32 addr)
 const char *
 CPU::disassembleWord(u16 value)
 {
-    static char result[16];
+    static thread_local char result[16];
 
     Moira::dump16(result, value);
     return result;
@@ -686,7 +787,7 @@ CPU::disassembleWord(u16 value)
 const char *
 CPU::disassembleInstr(u32 addr, isize *len)
 {
-    static char result[128];
+    static thread_local char result[128];
 
     int l = disassemble(result, addr);
 
@@ -697,7 +798,7 @@ CPU::disassembleInstr(u32 addr, isize *len)
 const char *
 CPU::disassembleWords(u32 addr, isize len)
 {
-    static char result[64];
+    static thread_local char result[64];
 
     dump16(result, addr, (int)len);
     return result;
@@ -753,6 +854,26 @@ CPU::dumpLogBuffer(std::ostream& os)
     dumpLogBuffer(os, debugger.loggedInstructions());
 }
 
+void
+CPU::startTrace(const fs::path &path, bool withRegisters)
+{
+    tracer.start(path, withRegisters);
+    flags |= moira::CPU_RECORD_INSTRUCTION;
+}
+
+void
+CPU::stopTrace()
+{
+    flags &= ~moira::CPU_RECORD_INSTRUCTION;
+    tracer.stop();
+}
+
+void
+CPU::decodeTrace(const fs::path &path, std::ostream& os)
+{
+    tracer.decode(path, os);
+}
+
 void
 CPU::disassembleRange(std::ostream& os, u32 addr, isize count)
 {
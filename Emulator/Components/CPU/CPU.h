@@ -15,6 +15,7 @@
 #include "CmdQueue.h"
 #include "RingBuffer.h"
 #include "Moira.h"
+#include "TraceRecorder.h"
 
 namespace vamiga {
 
@@ -33,10 +34,13 @@ class CPU : public moira::Moira, public Inspectable<CPUInfo>
         OPT_CPU_DASM_REVISION,
         OPT_CPU_DASM_SYNTAX,
         OPT_CPU_OVERCLOCKING,
-        OPT_CPU_RESET_VAL
+        OPT_CPU_RESET_VAL,
+        OPT_CPU_INSTR_CACHE,
+        OPT_CPU_DECOUPLED
     };
 
     friend class Moira;
+    friend class TraceRecorder;
 
     // The current configuration
     CPUConfig config = {};
@@ -54,6 +58,21 @@ public:
     // Number of cycles that should be executed at normal speed (overclocking)
     i64 slowCycles;
 
+    // Number of DMA cycles Agnus lags behind the CPU (decoupled overclocking)
+    DMACycle lag = 0;
+
+    // Maximum lag before Agnus is forced to catch up
+    static constexpr DMACycle maxLag = 64;
+
+    // Streams executed instructions into a file
+    TraceRecorder tracer = TraceRecorder(*this);
+
+private:
+
+    // Instruction words fed to the disassembler while decoding a trace
+    std::vector<u16> dasmOverlay;
+    u32 dasmOverlayAddr = 0;
+
 
     //
     // Initializing
@@ -67,6 +86,7 @@ public:
 
         CLONE(debt)
         CLONE(slowCycles)
+        CLONE(lag)
 
         CLONE(clock)
         CLONE(reg.pc)
@@ -127,6 +147,7 @@ private:
         // Items from CPU class
         << debt
         << slowCycles
+        << lag
 
         // Items from Moira class
         << clock
@@ -174,7 +195,8 @@ private:
         << config.revision
         << config.dasmRevision
         << config.overclocking
-        << config.regResetVal;
+        << config.regResetVal
+        << config.decoupled;
 
     } SERIALIZERS(serialize);
 
@@ -246,6 +268,9 @@ public:
     // Resynchronizes an overclocked CPU with the Agnus clock
     void resyncOverclockedCpu();
 
+    // Lets Agnus catch up with a decoupled CPU
+    void catchUp();
+
 
     //
     // Running the disassembler
@@ -277,6 +302,20 @@ public:
     void disassembleRange(std::ostream& os, std::pair<u32, u32> range, isize max = 255);
 
 
+    //
+    // Recording traces
+    //
+
+public:
+
+    // Starts or stops streaming executed instructions into a file
+    void startTrace(const fs::path &path, bool withRegisters = false) throws;
+    void stopTrace();
+
+    // Translates a recorded trace into a textual listing
+    void decodeTrace(const fs::path &path, std::ostream& os) throws;
+
+
     //
     // Changing state
     //
@@ -167,6 +167,8 @@ typedef struct
     DasmSyntax dasmSyntax;
     isize overclocking;
     u32 regResetVal;
+    bool instrCache;
+    bool decoupled;
 }
 CPUConfig;
 
@@ -16,6 +16,7 @@
 #include <bit>
 #include <vector>
 #include <stdexcept>
+#include <mutex>
 
 namespace vamiga::moira {
 
@@ -29,11 +30,6 @@ namespace vamiga::moira {
 
 Moira::Moira(Amiga &ref) : SubComponent(ref)
 {
-    exec = new ExecPtr[65536];
-    loop = new ExecPtr[65536];
-    if (BUILD_INSTR_INFO_TABLE) info = new InstrInfo[65536];
-    if (ENABLE_DASM) dasm = new DasmPtr[65536];
-
     createJumpTable(cpuModel, dasmModel);
 
     instrStyle = DasmStyle {
@@ -55,10 +51,7 @@ Moira::Moira(Amiga &ref) : SubComponent(ref)
 
 Moira::~Moira()
 {
-    if (exec) delete [] exec;
-    if (loop) delete [] loop;
-    if (info) delete [] info;
-    if (dasm) delete [] dasm;
+    if (instrCache) delete [] instrCache;
 }
 
 void
@@ -76,6 +69,46 @@ Moira::setModel(Model cpuModel, Model dasmModel)
     }
 }
 
+void
+Moira::setInstrCache(bool value)
+{
+    if (value && !instrCache) {
+
+        instrCache = new CachedWord[instrCacheSize];
+        flushInstrCache();
+    }
+    if (!value && instrCache) {
+
+        delete [] instrCache;
+        instrCache = nullptr;
+    }
+}
+
+void
+Moira::flushInstrCache()
+{
+    if (instrCache) {
+
+        // Odd addresses never match, because instructions are word-aligned
+        for (int i = 0; i < instrCacheSize; i++) instrCache[i].addr = 1;
+    }
+}
+
+u16
+Moira::readCached16(u32 addr)
+{
+    auto &entry = instrCache[(addr >> 1) & (instrCacheSize - 1)];
+
+    if (entry.addr != addr) {
+
+        auto value = read16(addr);
+        if (!isCacheable(addr)) return value;
+
+        entry = CachedWord { addr, value };
+    }
+    return entry.value;
+}
+
 void
 Moira::setDasmSyntax(DasmSyntax value)
 {
@@ -105,9 +138,9 @@ Moira::setNumberFormat(DasmStyle &style, const DasmNumberFormat &value)
 }
 
 bool
-Moira::hasCPI() const
+Moira::hasCPI(Model model)
 {
-    switch (cpuModel) {
+    switch (model) {
 
         case M68EC020: case M68020: case M68EC030: case M68030:
             return true;
@@ -311,6 +344,11 @@ Moira::execute()
             debugger.logInstruction();
         }
 
+        // If tracing is enabled, pass the instruction to the trace recorder
+        if (flags & CPU_RECORD_INSTRUCTION) {
+            recordInstruction();
+        }
+
         // Execute the instruction
         reg.pc += 2;
 
@@ -107,19 +107,53 @@ private:
 
     // Jump table holding the instruction handlers
     typedef void (Moira::*ExecPtr)(u16);
-    // ExecPtr exec[65536];
-    ExecPtr *exec = nullptr;
+    const ExecPtr *exec = nullptr;
 
     // Jump table holding the loop mode instruction handlers (68010 only)
-    // ExecPtr loop[65536];
-    ExecPtr *loop = nullptr;
+    const ExecPtr *loop = nullptr;
 
     // Jump table holding the disassebler handlers
     typedef void (Moira::*DasmPtr)(StrWriter&, u32&, u16) const;
-    DasmPtr *dasm = nullptr;
+    const DasmPtr *dasm = nullptr;
 
     // Table holding instruction infos
-    InstrInfo *info = nullptr;
+    const InstrInfo *info = nullptr;
+
+    /* The tables above don't depend on the state of a particular CPU. Hence,
+     * they are computed once for each combination of CPU model and
+     * disassembler model and shared by all Moira instances.
+     */
+    struct JumpTables {
+
+        ExecPtr exec[65536];
+        ExecPtr loop[65536];
+        DasmPtr dasm[65536];
+        InstrInfo info[65536];
+    };
+
+
+    //
+    // Instruction cache
+    //
+
+    /* If enabled, instruction words fetched from cacheable memory are stored
+     * in a direct-mapped table and served from there on subsequent fetches,
+     * bypassing the client's read handler. The cache is not part of the
+     * emulated hardware and doesn't alter timing. It is up to the client to
+     * decide which addresses are cacheable and to invalidate cached words
+     * whenever the underlying memory is modified.
+     */
+    struct CachedWord {
+
+        u32 addr;
+        u16 value;
+    };
+
+    // Number of cache entries (must be a power of two)
+    static constexpr int instrCacheSize = 1 << 14;
+
+    // The cache entries (nullptr if the cache is disabled)
+    CachedWord *instrCache = nullptr;
 
 
     //
@@ -133,14 +167,17 @@ public:
 
 protected:
 
-    // Creates or updates the jump tables
+    // Assigns the jump tables for the specified models
     void createJumpTable(Model cpuModel, Model dasmModel);
     void createJumpTable(Model model) { createJumpTable(model, model); }
 
 private:
 
+    // Returns the shared jump tables for the specified models
+    static const JumpTables &getJumpTables(Model cpuModel, Model dasmModel);
+
     // The createJumpTable core routine
-    template <Core C> void createJumpTable(Model model, bool registerDasm);
+    template <Core C> static void createJumpTable(JumpTables &tables, Model cpuModel, Model model, bool registerDasm);
 
 
     //
@@ -168,6 +205,34 @@ private:
     void setNumberFormat(DasmStyle &style, const DasmNumberFormat &value);
 
 
+    //
+    // Managing the instruction cache
+    //
+
+public:
+
+    // Enables or disables the instruction cache
+    void setInstrCache(bool value);
+
+    // Discards all cached words
+    void flushInstrCache();
+
+    // Discards the cached word at the specified address (if any)
+    void invalidateInstrCache(u32 addr) {
+
+        if (instrCache) {
+
+            auto &entry = instrCache[(addr >> 1) & (instrCacheSize - 1)];
+            if (entry.addr == (addr & ~1U)) entry.addr = 1;
+        }
+    }
+
+private:
+
+    // Reads an instruction word through the instruction cache
+    u16 readCached16(u32 addr);
+
+
     //
     // Querying CPU properties
     //
@@ -175,7 +240,8 @@ private:
 public:
 
     // Checks if the emulated CPU model has a coprocessor interface
-    bool hasCPI() const;
+    bool hasCPI() const { return hasCPI(cpuModel); }
+    static bool hasCPI(Model model);
 
     // Checks if the emulated CPU model has a memory managenemt unit
     bool hasMMU() const;
@@ -272,6 +338,9 @@ protected:
     virtual u16 read16OnReset(u32 addr) const { return read16(addr); }
     virtual u16 read16Dasm(u32 addr) const { return read16(addr); }
 
+    // Checks if the word at the specified address may be cached
+    virtual bool isCacheable(u32 addr) const { return false; }
+
     // Writes a byte or word into memory
     virtual void write8(u32 addr, u8 val) const = 0;
     virtual void write16(u32 addr, u16 val) const = 0;
@@ -286,6 +355,7 @@ protected:
     // Instruction delegates
     virtual void willExecute(const char *func, Instr I, Mode M, Size S, u16 opcode) { }
     virtual void didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode) { }
+    virtual void recordInstruction() { }
 
     // Exception delegates
     virtual void willExecute(ExceptionType exc, u16 vector) { }
@@ -319,6 +389,9 @@ protected:
     u16 read16OnReset(u32 addr) const;
     u16 read16Dasm(u32 addr) const;
 
+    // Checks if the word at the specified address may be cached
+    bool isCacheable(u32 addr) const;
+
     // Writes a byte or word into memory
     void write8(u32 addr, u8 val) const;
     void write16(u32 addr, u16 val) const;
@@ -333,6 +406,7 @@ protected:
     // Instruction delegates
     void willExecute(const char *func, Instr I, Mode M, Size S, u16 opcode);
     void didExecute(const char *func, Instr I, Mode M, Size S, u16 opcode);
+    void recordInstruction();
 
     // Exception delegates
     void willExecute(ExceptionType exc, u16 vector);
@@ -388,7 +388,11 @@ Moira::read(u32 addr)
     if constexpr (S == Word) {
 
         if (F & POLL) POLL_IPL;
-        result = read16(addr & addrMask<C>());
+        if (MS == MEM_PROG && instrCache) {
+            result = readCached16(addr & addrMask<C>());
+        } else {
+            result = read16(addr & addrMask<C>());
+        }
         SYNC(2);
     }
 
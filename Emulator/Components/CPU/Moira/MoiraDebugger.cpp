@@ -83,6 +83,7 @@ Guards::setAt(u32 addr, long ignores)
     guards[count].ignore = ignores;
     count++;
 
+    updateIndex();
     setNeedsCheck(true);
 }
 
@@ -104,6 +105,7 @@ Guards::removeAt(u32 addr)
             break;
         }
     }
+    updateIndex();
     setNeedsCheck(count != 0);
 }
 
@@ -113,6 +115,7 @@ Guards::replace(long nr, u32 addr)
     if (nr >= count || isSetAt(addr)) return;
 
     guards[nr].addr = addr;
+    updateIndex();
 }
 
 bool
@@ -147,20 +150,21 @@ void
 Guards::setEnable(long nr, bool val)
 {
     Guard *guard = guardNr(nr);
-    if (guard) guard->enabled = val;
+    if (guard) { guard->enabled = val; updateIndex(); }
 }
 
 void
 Guards::setEnableAt(u32 addr, bool val)
 {
     Guard *guard = guardAt(addr);
-    if (guard) guard->enabled = val;
+    if (guard) { guard->enabled = val; updateIndex(); }
 }
 
 void 
 Guards::setEnableAll(bool val)
 {
     for (int i = 0; i < count; i++) guards[i].enabled = val;
+    updateIndex();
 }
 
 void
@@ -173,17 +177,39 @@ Guards::ignore(long nr, long count)
 bool
 Guards::eval(u32 addr, Size S)
 {
-    for (int i = 0; i < count; i++) {
+    // Quick exit if no enabled guard is located in the accessed page(s)
+    if (!pageIsGuarded(addr) && !pageIsGuarded(addr + u32(S) - 1)) return false;
+
+    // Check all addresses covered by the access
+    for (u32 a = addr; a != addr + u32(S); a++) {
+
+        if (!addrIndex.contains(a)) continue;
 
-        if (guards[i].eval(addr, S)) {
+        if (Guard *guard = guardAt(a); guard->eval(addr, S)) {
 
-            hit = guards[i];
+            hit = *guard;
             return true;
         }
     }
     return false;
 }
 
+void
+Guards::updateIndex()
+{
+    addrIndex.clear();
+    for (auto &word : pageIndex) word = 0;
+
+    for (int i = 0; i < count; i++) {
+
+        if (!guards[i].enabled) continue;
+
+        u32 addr = guards[i].addr;
+        addrIndex.insert(addr);
+        pageIndex[addr >> 22] |= u64(1) << ((addr >> 16) & 63);
+    }
+}
+
 void
 Breakpoints::setNeedsCheck(bool value)
 {
@@ -10,6 +10,7 @@
 #include "MoiraTypes.h"
 #include "StrWriter.h"
 #include <map>
+#include <unordered_set>
 
 namespace vamiga::moira {
 
@@ -54,6 +55,15 @@ protected:
     // Number of currently stored guards
     long count = 0;
 
+    /* Lookup index. To speed up guard evaluation, the addresses of all enabled
+     * guards are kept in a hash set. In addition, a bitmap records each 64KB
+     * page containing at least one of these addresses. Hence, most accesses
+     * can be ruled out by a single bit test. The index is rebuilt whenever a
+     * guard is added, moved, removed, enabled, or disabled.
+     */
+    std::unordered_set<u32> addrIndex;
+    u64 pageIndex[1024] = { };
+
 public:
 
     // A copy of the latest match
@@ -92,7 +102,7 @@ public:
 
     void remove(long nr);
     void removeAt(u32 addr);
-    void removeAll() { count = 0; setNeedsCheck(false); }
+    void removeAll() { count = 0; updateIndex(); setNeedsCheck(false); }
 
 
     //
@@ -128,6 +138,16 @@ public:
 
     // Evaluates all guards
     bool eval(u32 addr, Size S = Byte);
+
+private:
+
+    // Rebuilds the lookup index
+    void updateIndex();
+
+    // Checks if an enabled guard is located in the page of the given address
+    bool pageIsGuarded(u32 addr) const {
+        return pageIndex[addr >> 22] & (u64(1) << ((addr >> 16) & 63));
+    }
 };
 
 class Breakpoints : public Guards {
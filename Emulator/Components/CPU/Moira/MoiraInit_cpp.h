@@ -156,30 +156,62 @@ parse(const char *s, int sum = 0)
 void
 Moira::createJumpTable(Model cpuModel, Model dasmModel)
 {
-    auto core = [&](Model model) {
-        return model == M68000 ? C68000 : model == M68010 ? C68010 : C68020;
-    };
+    auto &tables = getJumpTables(cpuModel, dasmModel);
 
-    Core cpuCore = core(cpuModel);
-    Core dasmCore = core(dasmModel);
+    exec = tables.exec;
+    loop = tables.loop;
+    dasm = ENABLE_DASM ? tables.dasm : nullptr;
+    info = BUILD_INSTR_INFO_TABLE ? tables.info : nullptr;
+}
+
+const Moira::JumpTables &
+Moira::getJumpTables(Model cpuModel, Model dasmModel)
+{
+    static constexpr int count = M68040 + 1;
+    static JumpTables *cache[count][count] = { };
+    static std::mutex mutex;
+
+    std::lock_guard<std::mutex> guard(mutex);
+
+    // Compute the tables on first use
+    if (!cache[cpuModel][dasmModel]) {
+
+        auto core = [&](Model model) {
+            return model == M68000 ? C68000 : model == M68010 ? C68010 : C68020;
+        };
 
-    // Register handlers based on the dasm model
-    if (dasmCore == C68000) createJumpTable<C68000>(dasmModel, true);
-    if (dasmCore == C68010) createJumpTable<C68010>(dasmModel, true);
-    if (dasmCore == C68020) createJumpTable<C68020>(dasmModel, true);
+        Core cpuCore = core(cpuModel);
+        Core dasmCore = core(dasmModel);
 
-    // If both models differ, overwrite the exec handlers
-    if (cpuModel != dasmModel) {
+        auto tables = new JumpTables();
 
-        if (cpuCore == C68000) createJumpTable<C68000>(cpuModel, false);
-        if (cpuCore == C68010) createJumpTable<C68010>(cpuModel, false);
-        if (cpuCore == C68020) createJumpTable<C68020>(cpuModel, false);
+        // Register handlers based on the dasm model
+        if (dasmCore == C68000) createJumpTable<C68000>(*tables, cpuModel, dasmModel, true);
+        if (dasmCore == C68010) createJumpTable<C68010>(*tables, cpuModel, dasmModel, true);
+        if (dasmCore == C68020) createJumpTable<C68020>(*tables, cpuModel, dasmModel, true);
+
+        // If both models differ, overwrite the exec handlers
+        if (cpuModel != dasmModel) {
+
+            if (cpuCore == C68000) createJumpTable<C68000>(*tables, cpuModel, cpuModel, false);
+            if (cpuCore == C68010) createJumpTable<C68010>(*tables, cpuModel, cpuModel, false);
+            if (cpuCore == C68020) createJumpTable<C68020>(*tables, cpuModel, cpuModel, false);
+        }
+
+        cache[cpuModel][dasmModel] = tables;
     }
+
+    return *cache[cpuModel][dasmModel];
 }
 
 template <Core C> void
-Moira::createJumpTable(Model model, bool regDasm)
+Moira::createJumpTable(JumpTables &tables, Model cpuModel, Model model, bool regDasm)
 {
+    [[maybe_unused]] auto exec = tables.exec;
+    [[maybe_unused]] auto loop = tables.loop;
+    [[maybe_unused]] auto dasm = tables.dasm;
+    [[maybe_unused]] auto info = tables.info;
+
     u16 opcode;
 
     //
@@ -1897,7 +1929,7 @@ Moira::createJumpTable(Model model, bool regDasm)
         // Coprocessor interface
         //
 
-        if (hasCPI()) {
+        if (hasCPI(cpuModel)) {
 
             opcode = parse("1111 ---0 10-- ----");
             ____XXX___XXXXXX(opcode, cpBcc, MODE_IP, Word, CpBcc, CIMS)
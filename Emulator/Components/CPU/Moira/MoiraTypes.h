@@ -474,6 +474,10 @@ static constexpr u16 AV_68000_UP        = AV_68000 | AV_68010_UP;
  * CPU_CHECK_BP, CPU_CHECK_WP, CPU_CHECK_CP:
  *    These flags indicate whether the CPU should check for breakpoints,
  *    watchpoints, or catchpoints.
+ *
+ * CPU_RECORD_INSTRUCTION:
+ *    If this flag is set, the CPU invokes the recordInstruction() delegate
+ *    before an instruction is executed.
  */
 static constexpr int CPU_IS_HALTED          = (1 << 8);
 static constexpr int CPU_IS_STOPPED         = (1 << 9);
@@ -485,6 +489,7 @@ static constexpr int CPU_TRACE_FLAG         = (1 << 14);
 static constexpr int CPU_CHECK_BP           = (1 << 15);
 static constexpr int CPU_CHECK_WP           = (1 << 16);
 static constexpr int CPU_CHECK_CP           = (1 << 17);
+static constexpr int CPU_RECORD_INSTRUCTION = (1 << 18);
 
 /* Execution flags
  *
@@ -0,0 +1,363 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "TraceRecorder.h"
+#include "CPU.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <unordered_map>
+
+namespace vamiga {
+
+static inline void put16(u8 *&p, u16 value)
+{
+    *p++ = u8(value);
+    *p++ = u8(value >> 8);
+}
+
+static inline void putVar(u8 *&p, u64 value)
+{
+    for (; value >= 0x80; value >>= 7) *p++ = u8(value | 0x80);
+    *p++ = u8(value);
+}
+
+static inline void putSigned(u8 *&p, i32 value)
+{
+    putVar(p, u32(value) << 1 ^ u32(value >> 31));
+}
+
+TraceRecorder::~TraceRecorder()
+{
+    stop();
+}
+
+void
+TraceRecorder::start(const fs::path &path, bool withRegisters)
+{
+    stop();
+
+    stream.open(path, std::ios::binary);
+    if (!stream.is_open()) throw Error(ERROR_FILE_CANT_WRITE, path);
+
+    // Reset the encoder
+    registers = withRegisters;
+    lastPc = 0;
+    lastSr = -1;
+    lastClock = cpu.getCpuClock();
+    for (auto &r : lastRegs) r = 0;
+    codeCache.assign(codeCacheSize, CodeLine { 0, -1 });
+    count = 0;
+
+    // Write the header
+    chunk.assign(chunkSize, 0);
+    u8 *p = chunk.data();
+    std::memcpy(p, magic, 4); p += 4;
+    *p++ = version;
+    *p++ = registers ? FLAG_REGISTERS : 0;
+    for (isize i = 0; i < 8; i++) *p++ = u8(u64(lastClock) >> (8 * i));
+    fill = p - chunk.data();
+
+    // Launch the writer thread
+    stopping = false;
+    recording = true;
+    writer = std::thread(&TraceRecorder::writeLoop, this);
+
+    debug(CPU_DEBUG, "Recording trace to %s\n", path.string().c_str());
+}
+
+void
+TraceRecorder::stop()
+{
+    if (!recording) return;
+
+    // Hand over the remaining data and wait for the writer thread to finish
+    flush();
+    {   std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    cond.notify_all();
+    writer.join();
+
+    if (stream.fail()) warn("Failed to write the trace file\n");
+    stream.close();
+    chunk = { };
+    codeCache = { };
+    recording = false;
+
+    debug(CPU_DEBUG, "Recorded %lld instructions\n", count);
+}
+
+void
+TraceRecorder::record()
+{
+    auto pc = cpu.getPC0();
+    auto opcode = cpu.getIRD();
+
+    // Make sure the current chunk can hold a code and an instruction record
+    if (fill > chunkSize - 2 * maxRecordSize) flush();
+
+    // Emit the instruction words if they haven't been emitted yet
+    auto &line = codeCache[(pc >> 1) & (codeCacheSize - 1)];
+    if (line.pc != pc || line.opcode != opcode) {
+
+        recordCode(pc);
+        line = CodeLine { pc, opcode };
+    }
+
+    u8 *p = chunk.data() + fill;
+    u8 *tag = p++;
+    *tag = 0;
+
+    putSigned(p, i32(pc - lastPc));
+    put16(p, opcode);
+    lastPc = pc;
+
+    if (auto sr = cpu.getSR(); sr != lastSr) {
+
+        *tag |= TAG_SR;
+        put16(p, sr);
+        lastSr = sr;
+    }
+
+    auto clock = cpu.getCpuClock();
+    putVar(p, u64(clock - lastClock));
+    lastClock = clock;
+
+    if (registers) {
+
+        u16 mask = 0;
+        for (isize i = 0; i < 16; i++) if (cpu.reg.r[i] != lastRegs[i]) mask |= 1 << i;
+
+        if (mask) {
+
+            *tag |= TAG_REGISTERS;
+            put16(p, mask);
+
+            for (isize i = 0; i < 16; i++) {
+
+                if (mask & (1 << i)) {
+
+                    putSigned(p, i32(cpu.reg.r[i] - lastRegs[i]));
+                    lastRegs[i] = cpu.reg.r[i];
+                }
+            }
+        }
+    }
+
+    fill = p - chunk.data();
+    count++;
+}
+
+void
+TraceRecorder::recordCode(u32 pc)
+{
+    char str[128];
+
+    // Determine the instruction length with the disassembler
+    auto words = std::clamp(cpu.disassemble(str, pc) / 2, 1, 11);
+
+    u8 *p = chunk.data() + fill;
+    *p++ = TAG_CODE;
+    putVar(p, pc);
+    *p++ = u8(words);
+    for (isize i = 0; i < words; i++) put16(p, cpu.read16Dasm(u32(pc + 2 * i)));
+
+    fill = p - chunk.data();
+}
+
+void
+TraceRecorder::flush()
+{
+    chunk.resize(fill);
+
+    {   std::unique_lock<std::mutex> lock(mutex);
+
+        // Throttle the emulator if the writer thread falls behind
+        cond.wait(lock, [this] { return isize(pending.size()) < maxPending; });
+        pending.push_back(std::move(chunk));
+    }
+    cond.notify_all();
+
+    chunk.assign(chunkSize, 0);
+    fill = 0;
+}
+
+void
+TraceRecorder::writeLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+
+        cond.wait(lock, [this] { return stopping || !pending.empty(); });
+
+        // Exit when all data has been written
+        if (pending.empty()) break;
+
+        auto data = std::move(pending.front());
+        pending.pop_front();
+
+        lock.unlock();
+        cond.notify_all();
+        stream.write((const char *)data.data(), std::streamsize(data.size()));
+        lock.lock();
+    }
+}
+
+void
+TraceRecorder::decode(const fs::path &path, std::ostream &os) const
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) throw Error(ERROR_FILE_NOT_FOUND, path);
+    auto *buf = in.rdbuf();
+
+    auto get8 = [&]() {
+
+        auto c = buf->sbumpc();
+        if (c == std::char_traits<char>::eof()) throw Error(ERROR_FILE_CANT_READ, path);
+        return u8(c);
+    };
+    auto get16 = [&]() {
+
+        u16 lo = get8();
+        return u16(lo | get8() << 8);
+    };
+    auto getVar = [&]() {
+
+        u64 value = 0;
+        for (isize shift = 0; shift < 64; shift += 7) {
+
+            auto byte = get8();
+            value |= u64(byte & 0x7F) << shift;
+            if (!(byte & 0x80)) break;
+        }
+        return value;
+    };
+    auto getSigned = [&]() {
+
+        auto value = u32(getVar());
+        return i32(value >> 1 ^ -(value & 1));
+    };
+
+    // Check the header
+    char id[4];
+    for (isize i = 0; i < 4; i++) id[i] = char(get8());
+    if (std::memcmp(id, magic, 4) != 0 || get8() != version) {
+        throw Error(ERROR_FILE_TYPE_MISMATCH, path);
+    }
+    auto flags = get8();
+    u64 clock = 0;
+    for (isize i = 0; i < 8; i++) clock |= u64(get8()) << (8 * i);
+
+    // Decoder state
+    std::unordered_map<u32, std::vector<u16>> code;
+    moira::StatusRegister sr = { };
+    u32 pc = 0;
+    u32 regs[16] = { };
+    i64 lines = 0;
+
+    // Feed the recorded instruction words into the disassembler
+    auto &overlay = cpu.dasmOverlay;
+    auto &overlayAddr = cpu.dasmOverlayAddr;
+
+    try {
+
+        while (buf->sgetc() != std::char_traits<char>::eof()) {
+
+            auto tag = get8();
+
+            if (tag & TAG_CODE) {
+
+                auto addr = u32(getVar());
+                auto &words = code[addr];
+                words.resize(get8());
+                for (auto &word : words) word = get16();
+                continue;
+            }
+
+            pc += u32(getSigned());
+            auto opcode = get16();
+
+            if (tag & TAG_SR) {
+
+                auto value = get16();
+                sr.t1 = value & 0x8000;
+                sr.t0 = value & 0x4000;
+                sr.s = value & 0x2000;
+                sr.m = value & 0x1000;
+                sr.x = value & 0x0010;
+                sr.n = value & 0x0008;
+                sr.z = value & 0x0004;
+                sr.v = value & 0x0002;
+                sr.c = value & 0x0001;
+                sr.ipl = u8(value >> 8 & 7);
+            }
+
+            clock += getVar();
+
+            u16 mask = 0;
+            if (tag & TAG_REGISTERS) {
+
+                if (!(flags & FLAG_REGISTERS)) throw Error(ERROR_FILE_CANT_READ, path);
+                mask = get16();
+                for (isize i = 0; i < 16; i++) if (mask & (1 << i)) regs[i] += u32(getSigned());
+            }
+
+            /* The register block contains the registers modified by the previous
+             * instruction. Hence, they are appended to the previous line. The
+             * first block contains the initial values and gets a line of its own.
+             */
+            if (mask) {
+
+                if (!lines) os << std::setfill(' ') << std::right << std::setw(12) << clock << "  Registers";
+
+                for (isize i = 0; i < 16; i++) {
+
+                    if (mask & (1 << i)) {
+
+                        os << "  " << (i < 8 ? 'D' : 'A') << (i & 7) << "=";
+                        os << std::hex << std::setfill('0') << std::setw(8) << regs[i] << std::dec;
+                    }
+                }
+                if (!lines) os << std::endl;
+            }
+            if (lines) os << std::endl;
+
+            // Disassemble the instruction
+            char addrStr[16], srStr[18], instrStr[128];
+
+            if (auto it = code.find(pc); it != code.end()) {
+                overlay = it->second;
+            } else {
+                overlay = { opcode };
+            }
+            overlayAddr = pc;
+
+            cpu.dump24(addrStr, pc);
+            cpu.disassembleSR(srStr, sr);
+            cpu.disassemble(instrStr, pc);
+
+            os << std::setfill(' ') << std::right << std::setw(12) << clock;
+            os << "  " << addrStr << "  " << srStr << "  " << instrStr;
+            lines++;
+        }
+        if (lines) os << std::endl;
+
+    } catch (...) {
+
+        overlay.clear();
+        throw;
+    }
+
+    overlay.clear();
+}
+
+}
@@ -0,0 +1,183 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "CoreObject.h"
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vamiga {
+
+namespace fs = ::std::filesystem;
+
+class CPU;
+
+/* The trace recorder streams all executed instructions into a file. Unlike
+ * the log buffer of the Moira debugger, which keeps the most recent
+ * instructions in a small ring buffer, the recorder is able to capture
+ * hundreds of millions of instructions, e.g., an entire game boot. To keep
+ * the files small, each instruction is stored as a compact binary record.
+ * Encoding happens in the emulator thread, whereas a background thread
+ * writes the encoded data to disk.
+ *
+ * File layout:
+ *
+ *   Header: "VATR" | version (u8) | flags (u8) | start clock (i64)
+ *
+ *   Instruction record:
+ *     tag (u8) | pc delta (svar) | opcode (u16) | [sr (u16)] | cycles (var)
+ *     | [register mask (u16) | register deltas (svar)...]
+ *
+ *   Code record:
+ *     tag (u8) | pc (var) | word count (u8) | instruction words (u16)...
+ *
+ * All multi-byte values are stored in little endian format. 'var' denotes
+ * an unsigned LEB128 varint, 'svar' a zigzag encoded signed varint. The SR
+ * is only stored if it has changed, and the register block only contains
+ * the data and address registers that have been modified by the previous
+ * instruction. To enable offline disassembly, the instruction words are
+ * emitted in a code record whenever an instruction is seen for the first
+ * time or the opcode at its address has changed.
+ */
+class TraceRecorder final : public CoreObject {
+
+public:
+
+    // File format identifiers
+    static constexpr const char *magic = "VATR";
+    static constexpr u8 version = 1;
+
+    // Header flags
+    static constexpr u8 FLAG_REGISTERS  = 0x01;
+
+    // Record tags
+    static constexpr u8 TAG_SR          = 0x01;
+    static constexpr u8 TAG_REGISTERS   = 0x02;
+    static constexpr u8 TAG_CODE        = 0x80;
+
+    // Size of the chunks handed over to the writer thread
+    static constexpr isize chunkSize = 1024 * 1024;
+
+    // Maximum number of chunks waiting to be written
+    static constexpr isize maxPending = 16;
+
+    // Maximum size of a single record
+    static constexpr isize maxRecordSize = 128;
+
+private:
+
+    // The recorded CPU
+    CPU &cpu;
+
+    // Indicates whether a recording is in progress
+    bool recording = false;
+
+    // Indicates whether registers are recorded
+    bool registers = false;
+
+    // Encoder state
+    u32 lastPc = 0;
+    i32 lastSr = -1;
+    i64 lastClock = 0;
+    u32 lastRegs[16] = { };
+
+    // Direct-mapped table of the instructions whose code has been emitted
+    static constexpr isize codeCacheSize = 1 << 14;
+    struct CodeLine { u32 pc; i32 opcode; };
+    std::vector<CodeLine> codeCache;
+
+    // Number of recorded instructions
+    i64 count = 0;
+
+    // The chunk that is currently filled and the number of bytes in use
+    std::vector<u8> chunk;
+    isize fill = 0;
+
+    // Chunks waiting to be written
+    std::deque<std::vector<u8>> pending;
+
+    // Synchronization with the writer thread
+    std::mutex mutex;
+    std::condition_variable cond;
+    bool stopping = false;
+
+    // The writer thread and the output stream it writes to
+    std::thread writer;
+    std::ofstream stream;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    TraceRecorder(CPU &ref) : cpu(ref) { }
+    ~TraceRecorder();
+
+
+    //
+    // Methods from CoreObject
+    //
+
+public:
+
+    const char *objectName() const override { return "TraceRecorder"; }
+
+
+    //
+    // Recording
+    //
+
+public:
+
+    // Starts recording into the specified file
+    void start(const fs::path &path, bool withRegisters = false) throws;
+
+    // Stops recording and flushes all pending data
+    void stop();
+
+    // Indicates whether a recording is in progress
+    bool isRecording() const { return recording; }
+
+    // Returns the number of instructions recorded so far
+    i64 recorded() const { return count; }
+
+    // Records the instruction that is about to be executed
+    void record();
+
+private:
+
+    // Emits a code record for the instruction at the specified address
+    void recordCode(u32 pc);
+
+    // Hands over the current chunk to the writer thread
+    void flush();
+
+    // Main function of the writer thread
+    void writeLoop();
+
+
+    //
+    // Decoding
+    //
+
+public:
+
+    // Translates a recorded trace into a textual listing
+    void decode(const fs::path &path, std::ostream &os) const throws;
+};
+
+}
@@ -13,6 +13,8 @@
 #include "Agnus.h"
 #include "Amiga.h"
 #include "IOUtils.h"
+#include <array>
+#include <bit>
 
 namespace vamiga {
 
@@ -43,6 +45,7 @@ Denise::getOption(Option option) const
         case OPT_DENISE_REVISION:           return config.revision;
         case OPT_DENISE_VIEWPORT_TRACKING:  return config.viewportTracking;
         case OPT_DENISE_FRAME_SKIPPING:     return config.frameSkipping;
+        case OPT_DENISE_VIDEO_OUTPUT:       return config.videoOutput;
         case OPT_DENISE_HIDDEN_BITPLANES:   return config.hiddenBitplanes;
         case OPT_DENISE_HIDDEN_SPRITES:     return config.hiddenSprites;
         case OPT_DENISE_HIDDEN_LAYERS:      return config.hiddenLayers;
@@ -70,6 +73,7 @@ Denise::checkOption(Option opt, i64 value)
 
         case OPT_DENISE_VIEWPORT_TRACKING:
         case OPT_DENISE_FRAME_SKIPPING:
+        case OPT_DENISE_VIDEO_OUTPUT:
         case OPT_DENISE_HIDDEN_BITPLANES:
         case OPT_DENISE_HIDDEN_SPRITES:
         case OPT_DENISE_HIDDEN_LAYERS:
@@ -106,6 +110,11 @@ Denise::setOption(Option option, i64 value)
             config.frameSkipping = (isize)value;
             return;
 
+        case OPT_DENISE_VIDEO_OUTPUT:
+
+            config.videoOutput = (bool)value;
+            return;
+
         case OPT_DENISE_HIDDEN_BITPLANES:
             
             config.hiddenBitplanes = (u8)value;
@@ -192,49 +201,50 @@ Denise::updateShiftRegistersEven()
     }
 }
 
-void
-Denise::extractSlices(u8 slices[16])
-{
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[0] & mask) << 0) |
-                          (!!(shiftReg[1] & mask) << 1) |
-                          (!!(shiftReg[2] & mask) << 2) |
-                          (!!(shiftReg[3] & mask) << 3) |
-                          (!!(shiftReg[4] & mask) << 4) |
-                          (!!(shiftReg[5] & mask) << 5) );
-    }
-}
+/* Lookup table for the planar-to-chunky conversion. The table spreads the
+ * eight bits of a bitplane byte over the lowest bit of eight chunky pixels.
+ * Storing the result in native byte order puts the leftmost pixel (MSB) into
+ * the first byte in memory.
+ */
+static constexpr auto p2cTable = []() {
 
-void
-Denise::extractSlicesOdd(u8 slices[16])
-{
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[0] & mask) << 0) |
-                          (!!(shiftReg[2] & mask) << 2) |
-                          (!!(shiftReg[4] & mask) << 4) );
+    std::array<u64, 256> table = { };
+
+    for (isize value = 0; value < 256; value++) {
+        for (isize i = 0; i < 8; i++) {
+
+            if (value & (0x80 >> i)) {
+
+                auto byte = std::endian::native == std::endian::little ? i : 7 - i;
+                table[value] |= u64(1) << (8 * byte);
+            }
+        }
     }
-}
+    return table;
+}();
 
-void
-Denise::extractSlicesEven(u8 slices[16])
+template <u8 planes> void
+Denise::planarToChunky(const u16 regs[6], u8 slices[16])
 {
-    u16 mask = 0x8000;
-    for (isize i = 0; i < 16; i++, mask >>= 1) {
-        
-        slices[i] = (u8) ((!!(shiftReg[1] & mask) << 1) |
-                          (!!(shiftReg[3] & mask) << 3) |
-                          (!!(shiftReg[5] & mask) << 5) );
+    u64 left = 0, right = 0;
+
+    for (isize i = 0; i < 6; i++) {
+
+        if (planes & (1 << i)) {
+
+            left |= p2cTable[HI_BYTE(regs[i])] << i;
+            right |= p2cTable[LO_BYTE(regs[i])] << i;
+        }
     }
+
+    std::memcpy(slices, &left, 8);
+    std::memcpy(slices + 8, &right, 8);
 }
 
 template <Resolution mode> void
 Denise::drawOdd(Pixel offset)
 {
-    static constexpr u16 masks[7] = {
+    static constexpr u8 masks[7] = {
         
         0b000000, // 0 bitplanes
         0b000001, // 1 bitplanes
@@ -245,52 +255,7 @@ Denise::drawOdd(Pixel offset)
         0b010101  // 6 bitplanes
     };
     
-    u16 mask = masks[bpu()];
-    Pixel pixel = agnus.pos.pixel() + offset + 2;
-
-    u8 slices[16];
-    extractSlicesOdd(slices);
-    
-    for (isize i = 0; i < 16; i++) {
-        
-        u8 index = slices[i] & mask;
-
-        switch (mode) {
-
-            case LORES:
-
-                // Synthesize two lores pixels
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                break;
-
-            case HIRES:
-
-                // Synthesize one hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b101010) | index;
-                pixel++;
-                break;
-
-            case SHRES:
-
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111011) | index << 2);
-                } else {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111110) | index);
-                    pixel++;
-                }
-                break;
-
-            default:
-                fatalError;
-        }
-    }
+    drawSlices <mode, 0b010101> (masks[bpu()], offset);
 
     // Clear the shift registers
     shiftReg[0] = shiftReg[2] = shiftReg[4] = 0;
@@ -299,7 +264,7 @@ Denise::drawOdd(Pixel offset)
 template <Resolution mode> void
 Denise::drawEven(Pixel offset)
 {    
-    static constexpr u16 masks[7] = {
+    static constexpr u8 masks[7] = {
         
         0b000000, // 0 bitplanes
         0b000000, // 1 bitplanes
@@ -310,52 +275,7 @@ Denise::drawEven(Pixel offset)
         0b101010  // 6 bitplanes
     };
     
-    u16 mask = masks[bpu()];
-    Pixel pixel = agnus.pos.pixel() + offset + 2;
-
-    u8 slices[16];
-    extractSlicesEven(slices);
-    
-    for (isize i = 0; i < 16; i++) {
-
-        u8 index = slices[i] & mask;
-
-        switch (mode) {
-
-            case LORES:
-
-                // Synthesize s lores pixel
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                break;
-
-            case HIRES:
-
-                // Synthesize a hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = (dBuffer[pixel] & 0b010101) | index;
-                pixel++;
-                break;
-
-            case SHRES:
-
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b110111) | index << 2);
-                } else {
-                    dBuffer[pixel] = u8((dBuffer[pixel] & 0b111101) | index);
-                    pixel++;
-                }
-                break;
-
-            default:
-                fatalError;
-        }
-    }
+    drawSlices <mode, 0b101010> (masks[bpu()], offset);
 
     // Clear the shift registers
     shiftReg[1] = shiftReg[3] = shiftReg[5] = 0;
@@ -371,7 +291,7 @@ Denise::drawBoth(Pixel offset)
         return;
     }
 
-    static constexpr u16 masks[7] = {
+    static constexpr u8 masks[7] = {
 
         0b000000, // 0 bitplanes
         0b000001, // 1 bitplanes
@@ -382,55 +302,63 @@ Denise::drawBoth(Pixel offset)
         0b111111  // 6 bitplanes
     };
 
-    u16 mask = masks[bpu()];
+    drawSlices <mode, 0b111111> (masks[bpu()], offset);
+
+    // Clear the shift registers
+    for (isize i = 0; i < 6; i++) shiftReg[i] = 0;
+}
+
+template <Resolution mode, u8 planes> void
+Denise::drawSlices(u8 mask, Pixel offset)
+{
+    // Bits of the existing pixels belonging to the other bitplanes
+    constexpr u8 keep =
+    planes == 0b010101 ? 0b101010 : planes == 0b101010 ? 0b010101 : 0;
+
     Pixel pixel = agnus.pos.pixel() + offset + 2;
+    u8 *p = dBuffer + pixel;
 
     u8 slices[16];
-    extractSlices(slices);
+    planarToChunky<planes>(shiftReg, slices);
+    for (isize i = 0; i < 16; i++) slices[i] &= mask;
 
-    for (isize i = 0; i < 16; i++) {
+    if constexpr (mode == LORES) {
 
-        u8 index = slices[i] & mask;
+        // Synthesize 32 lores pixels
+        assert(pixel + 31 < isizeof(dBuffer));
+        for (isize i = 0; i < 16; i++) {
 
-        switch (mode) {
+            p[2 * i] = u8((p[2 * i] & keep) | slices[i]);
+            p[2 * i + 1] = u8((p[2 * i + 1] & keep) | slices[i]);
+        }
+    }
 
-            case LORES:
+    if constexpr (mode == HIRES) {
 
-                // Synthesize s lores pixel
-                assert(pixel + 1 < isizeof(dBuffer));
-                dBuffer[pixel] = index;
-                pixel++;
-                dBuffer[pixel] = index;
-                pixel++;
-                break;
+        // Synthesize 16 hires pixels
+        assert(pixel + 15 < isizeof(dBuffer));
+        for (isize i = 0; i < 16; i++) {
 
-            case HIRES:
+            p[i] = u8((p[i] & keep) | slices[i]);
+        }
+    }
 
-                // Synthesize a hires pixel
-                assert(pixel < isizeof(dBuffer));
-                dBuffer[pixel] = index;
-                pixel++;
-                break;
+    if constexpr (mode == SHRES) {
 
-            case SHRES:
+        // Bits to keep when merging the first and the second slice
+        constexpr u8 keep1 =
+        planes == 0b010101 ? 0b111011 : planes == 0b101010 ? 0b110111 : 0;
+        constexpr u8 keep2 =
+        planes == 0b010101 ? 0b111110 : planes == 0b101010 ? 0b111101 : 0xFF;
 
-                // Synthesize a superHires pixel
-                assert(pixel < isizeof(dBuffer));
-                if (i % 2 == 0) {
-                    dBuffer[pixel] = u8(index << 2);
-                } else {
-                    dBuffer[pixel] = u8(dBuffer[pixel] | index);
-                    pixel++;
-                }
-                break;
+        // Synthesize 8 super-hires pixels (each made of two slices)
+        assert(pixel + 7 < isizeof(dBuffer));
+        for (isize i = 0; i < 8; i++) {
 
-            default:
-                fatalError;
+            auto value = u8((p[i] & keep1) | slices[2 * i] << 2);
+            p[i] = u8((value & keep2) | slices[2 * i + 1]);
         }
     }
-
-    // Clear the shift registers
-    for (isize i = 0; i < 6; i++) shiftReg[i] = 0;
 }
 
 void
@@ -556,10 +484,10 @@ Denise::translate()
         RegChange &change = conChanges.elements[i];
 
         // Translate a chunk of bitplane data
-        if (dual) {
-            translateDPF(pixel, trigger, state);
+        if (scalarKernels) {
+            dual ? translateDPFScalar(pixel, trigger, state) : translateSPFScalar(pixel, trigger, state);
         } else {
-            translateSPF(pixel, trigger, state);
+            dual ? translateDPF(pixel, trigger, state) : translateSPF(pixel, trigger, state);
         }
         pixel = trigger;
 
@@ -596,6 +524,85 @@ Denise::translate()
 
 void
 Denise::translateSPF(Pixel from, Pixel to, PFState &state)
+{
+    /* This function is the branch-free counterpart of translateSPFScalar().
+     * Both functions produce the same output. Inside the loops, conditionals
+     * are only used to select values which allows the compiler to vectorize
+     * the code.
+     */
+    if (!state.zpf2 && !state.ham) {
+
+        // Eliminate the data of the first four bitplanes if BPL5 is set
+        for (Pixel i = from; i < to; i++) {
+
+            u8 s = dBuffer[i];
+            mBuffer[i] = s & ((s & 0x10) ? 0x30 : 0xFF);
+            zBuffer[i] = 0;
+        }
+        return;
+    }
+
+    // Translate the usual way
+    u16 zpf2 = state.zpf2;
+    for (Pixel i = from; i < to; i++) {
+
+        zBuffer[i] = dBuffer[i] ? zpf2 : 0;
+    }
+}
+
+void
+Denise::translateDPF(Pixel from, Pixel to, PFState &state)
+{
+    // Recompute the lookup tables if the playfield priorities have changed
+    u64 key = u64(state.zpf1) | u64(state.zpf2) << 16 | u64(state.prio) << 32;
+    if (key != dpfKey) { updateDpfTables(state); dpfKey = key; }
+
+    for (Pixel i = from; i < to; i++) {
+
+        u8 s = dBuffer[i] & 0x3F;
+        mBuffer[i] = dpfIndex[s];
+        zBuffer[i] = dpfDepth[s];
+    }
+}
+
+void
+Denise::updateDpfTables(const PFState &state)
+{
+    /* If the priority of a playfield is set to an illegal value (zpf1 or
+     * zpf2 will be 0 in that case), all pixels are drawn transparent.
+     */
+    u8 mask1 = state.zpf1 ? 0b1111 : 0b0000;
+    u8 mask2 = state.zpf2 ? 0b1111 : 0b0000;
+
+    for (u8 s = 0; s < 64; s++) {
+
+        // Determine color indices for both playfields
+        u8 index1 = (((s & 1) >> 0) | ((s & 4) >> 1) | ((s & 16) >> 2));
+        u8 index2 = (((s & 2) >> 1) | ((s & 8) >> 2) | ((s & 32) >> 3));
+
+        if (index1 && (!index2 || !state.prio)) {
+
+            // PF1 is visible
+            dpfIndex[s] = index1 & mask1;
+            dpfDepth[s] = state.zpf1 | (index2 ? Z_DPF12 : Z_DPF1);
+
+        } else if (index2) {
+
+            // PF2 is visible
+            dpfIndex[s] = (index2 | 0b1000) & mask2;
+            dpfDepth[s] = state.zpf2 | (index1 ? Z_DPF21 : Z_DPF2);
+
+        } else {
+
+            // Both playfields are transparent
+            dpfIndex[s] = 0;
+            dpfDepth[s] = Z_DPF;
+        }
+    }
+}
+
+void
+Denise::translateSPFScalar(Pixel from, Pixel to, PFState &state)
 {
     /* Check for invalid bitplane modes. If the priority of the second bitplane
      * is set to an invalid value (> 4), Denise ignores the data from the first
@@ -632,17 +639,17 @@ Denise::translateSPF(Pixel from, Pixel to, PFState &state)
 }
 
 void
-Denise::translateDPF(Pixel from, Pixel to, PFState &state)
+Denise::translateDPFScalar(Pixel from, Pixel to, PFState &state)
 {
     if (state.prio) {
-        translateDPF <true> (from, to, state);
+        translateDPFScalar <true> (from, to, state);
     } else {
-        translateDPF <false> (from, to, state);
+        translateDPFScalar <false> (from, to, state);
     }
 }
 
 template <bool prio> void
-Denise::translateDPF(Pixel from, Pixel to, PFState &state)
+Denise::translateDPFScalar(Pixel from, Pixel to, PFState &state)
 {
     /* If the priority of a playfield is set to an illegal value (zpf1 or
      * zpf2 will be 0 in that case), all pixels are drawn transparent.
@@ -1260,7 +1267,7 @@ Denise::hsyncHandler(isize vpos)
     updateBorderBuffer();
 
     // Check if we are below the VBLANK area
-    if (vpos >= 26 && !frameSkips) {
+    if (vpos >= 26 && isRendering()) {
 
         // Translate bitplane data to color register indices
         translate();
@@ -1279,6 +1286,24 @@ Denise::hsyncHandler(isize vpos)
             pixelEngine.hide(vpos, config.hiddenLayers, config.hiddenLayerAlpha);
         }
         
+    } else if (vpos >= 26) {
+
+        /* The line is not rendered. Translation and colorization are skipped
+         * unless the depth buffer is needed for detecting sprite collisions.
+         */
+        if (wasArmed && (config.clxSprSpr || config.clxSprPlf)) {
+            translate();
+        } else {
+            conChanges.clear();
+        }
+
+        // Update the sprite state and perform the collision checks
+        drawSprites();
+        if (config.clxPlfPlf) checkP2PCollisions();
+
+        // Keep the color registers up to date
+        pixelEngine.replayColRegChanges();
+
     } else {
         
         drawSprites();
@@ -1295,7 +1320,9 @@ Denise::hsyncHandler(isize vpos)
     assert(diwChanges.isEmpty());
     
     // Clear the last pixel if this line was a short line
-    if (agnus.pos.hLatched == HPOS_CNT_PAL) pixelEngine.getWorkingBuffer().clear(vpos, HPOS_MAX);
+    if (agnus.pos.hLatched == HPOS_CNT_PAL && isRendering()) {
+        pixelEngine.getWorkingBuffer().clear(vpos, HPOS_MAX);
+    }
 
     // Clear the dBuffer
     std::memset(dBuffer, 0, sizeof(dBuffer));
@@ -1335,7 +1362,8 @@ Denise::eofHandler()
     // Run the frame skip logic
     if (frameSkips == 0) {
 
-        pixelEngine.swapBuffers();
+        // Only hand over frames that have actually been drawn
+        if (isRendering()) pixelEngine.swapBuffers();
         frameSkips = emulator.isWarping() ? config.frameSkipping : 0;
 
     } else {
@@ -1344,12 +1372,16 @@ Denise::eofHandler()
     }
 }
 
+template void Denise::planarToChunky<0b010101>(const u16 regs[6], u8 slices[16]);
+template void Denise::planarToChunky<0b101010>(const u16 regs[6], u8 slices[16]);
+template void Denise::planarToChunky<0b111111>(const u16 regs[6], u8 slices[16]);
+
 template void Denise::drawOdd<false>(Pixel offset);
 template void Denise::drawOdd<true>(Pixel offset);
 template void Denise::drawEven<false>(Pixel offset);
 template void Denise::drawEven<true>(Pixel offset);
 
-template void Denise::translateDPF<true>(Pixel from, Pixel to, PFState &state);
-template void Denise::translateDPF<false>(Pixel from, Pixel to, PFState &state);
+template void Denise::translateDPFScalar<true>(Pixel from, Pixel to, PFState &state);
+template void Denise::translateDPFScalar<false>(Pixel from, Pixel to, PFState &state);
 
 }
@@ -37,6 +37,7 @@ class Denise : public SubComponent, public Inspectable<DeniseInfo> {
         OPT_DENISE_REVISION,
         OPT_DENISE_VIEWPORT_TRACKING,
         OPT_DENISE_FRAME_SKIPPING,
+        OPT_DENISE_VIDEO_OUTPUT,
         OPT_DENISE_HIDDEN_BITPLANES,
         OPT_DENISE_HIDDEN_SPRITES,
         OPT_DENISE_HIDDEN_LAYERS,
@@ -76,6 +77,9 @@ public:
     // Frame skip counter (activated in warp mode)
     isize frameSkips = 0;
 
+    // Suppresses video output while fast-forwarding the run-ahead instance
+    bool noVideo = false;
+
     //
     // Registers
     //
@@ -321,7 +325,34 @@ public:
     static int upperPlayfield(u16 z) {
         return ((z & Z_DUAL) == Z_DPF2 || (z & Z_DUAL) == Z_DPF21) ? 2 : 1;
     }
-    
+
+    /* Dual-playfield lookup tables
+     *
+     * In dual-playfield mode, the color index and the depth of a pixel only
+     * depend on the six bitplane bits and the playfield priorities stored in
+     * BPLCON2. Hence, translateDPF() maps each pixel with two table lookups.
+     * The tables are recomputed whenever the playfield priorities change.
+     */
+    u8 dpfIndex[64];
+    u16 dpfDepth[64];
+
+    // The playfield priorities the lookup tables have been computed for
+    u64 dpfKey = UINT64_MAX;
+
+
+    //
+    // Rendering kernels
+    //
+
+public:
+
+    /* The translation and colorization routines exist in two versions. The
+     * default versions are written in a branch-free style which enables the
+     * compiler to vectorize the inner loops. The scalar versions are kept as
+     * a reference. They are utilized to verify the optimized routines.
+     */
+    bool scalarKernels = false;
+
     
     //
     // Initializing
@@ -340,6 +371,7 @@ public:
         CLONE(screenRecorder)
 
         CLONE(clock)
+        CLONE(frameSkips)
 
         CLONE(diwstrt)
         CLONE(diwstop)
@@ -384,10 +416,9 @@ public:
         CLONE(spriteClipBegin)
         CLONE(spriteClipEnd)
 
+        // iBuffer and mBuffer are skipped (they are rebuilt before use)
         CLONE_ARRAY(dBuffer)
         CLONE_ARRAY(bBuffer)
-        CLONE_ARRAY(iBuffer)
-        CLONE_ARRAY(mBuffer)
         CLONE_ARRAY(zBuffer)
 
         return *this;
@@ -521,10 +552,8 @@ public:
     void updateShiftRegistersOdd();
     void updateShiftRegistersEven();
 
-    // Extracts a bit slice from the shift registers
-    void extractSlices(u8 slices[16]);
-    void extractSlicesOdd(u8 slices[16]);
-    void extractSlicesEven(u8 slices[16]);
+    // Converts the selected bitplane registers into 16 chunky pixels
+    template <u8 planes> static void planarToChunky(const u16 regs[6], u8 slices[16]);
 
     
     //
@@ -551,6 +580,9 @@ private:
     template <Resolution mode> void drawEven(Pixel offset);
     template <Resolution mode> void drawBoth(Pixel offset);
 
+    // Writes 16 chunky pixels of the selected bitplanes into dBuffer
+    template <Resolution mode, u8 planes> void drawSlices(u8 mask, Pixel offset);
+
     // Data type used by the translation functions
     typedef struct { u16 zpf1; u16 zpf2; bool prio; bool ham; } PFState;
 
@@ -562,9 +594,14 @@ private:
 
     // Called by translate() in dual-playfield mode
     void translateDPF(Pixel from, Pixel to, PFState &state);
-    
-    // Called by translateDPF(...)
-    template <bool prio> void translateDPF(Pixel from, Pixel to, PFState &state);
+
+    // Recomputes the dual-playfield lookup tables
+    void updateDpfTables(const PFState &state);
+
+    // Reference implementations of the translation routines
+    void translateSPFScalar(Pixel from, Pixel to, PFState &state);
+    void translateDPFScalar(Pixel from, Pixel to, PFState &state);
+    template <bool prio> void translateDPFScalar(Pixel from, Pixel to, PFState &state);
 
     
     //
@@ -652,6 +689,12 @@ public:
     // Called by Agnus at the end of each frame
     void eofHandler();
 
+    /* Checks whether the current frame produces video output. If not, the
+     * drawing stages are skipped. Only the architecturally visible effects
+     * such as collision bits and sprite state changes are emulated.
+     */
+    bool isRendering() const { return config.videoOutput && !noVideo && !frameSkips; }
+
     
     //
     // Accessing registers (DeniseRegs.cpp)
@@ -90,6 +90,9 @@ typedef struct
     // Number of frames to be skipped in warp mode
     isize frameSkipping;
 
+    // Renders the emulated frames (disabled in render-free runs)
+    bool videoOutput;
+
     // Hides certain bitplanes
     u8 hiddenBitplanes;
 
@@ -48,6 +48,9 @@ PixelEngine::_initialize()
     palette[65] = TEXEL(GpuColor(0xD0, 0x00, 0x00).rawValue);
     palette[66] = TEXEL(GpuColor(0xA0, 0x00, 0x00).rawValue);
     palette[67] = TEXEL(GpuColor(0x90, 0x00, 0x00).rawValue);
+
+    // Setup the color space (it must always match the current configuration)
+    updateRGBA();
 }
 
 void
@@ -395,6 +398,8 @@ PixelEngine::colorize(isize line)
             colorizeSHRES(dst, pixel, trigger);
         } else if (hamMode) {
             colorizeHAM(dst, pixel, trigger, hold);
+        } else if (denise.scalarKernels) {
+            colorizeScalar(dst, pixel, trigger);
         } else {
             colorize(dst, pixel, trigger);
         }
@@ -418,12 +423,27 @@ PixelEngine::colorize(Texel *dst, Pixel from, Pixel to)
 {
     auto *mbuf = denise.mBuffer;
     auto *bbuf = denise.bBuffer;
+    u8 index[HPIXELS];
 
-    /*
+    /* The colorization is split into two passes. The first pass merges the
+     * border and playfield color indices. It is free of data-dependent memory
+     * accesses and gets vectorized by the compiler. The second pass performs
+     * the palette lookups.
+     */
     for (Pixel i = from; i < to; i++) {
-        dst[i] = palette[mbuf[i]];
+        index[i] = bbuf[i] == 0xFF ? mbuf[i] : bbuf[i];
     }
-    */
+    for (Pixel i = from; i < to; i++) {
+        dst[i] = palette[index[i]];
+    }
+}
+
+void
+PixelEngine::colorizeScalar(Texel *dst, Pixel from, Pixel to)
+{
+    auto *mbuf = denise.mBuffer;
+    auto *bbuf = denise.bBuffer;
+
     for (Pixel i = from; i < to; i++) {
         dst[i] = palette[bbuf[i] == 0xFF ? mbuf[i] : bbuf[i]];
     }
@@ -439,9 +459,7 @@ PixelEngine::colorizeSHRES(Texel *dst, Pixel from, Pixel to)
     if constexpr (sizeof(Texel) == 4) {
 
         // Output two super-hires pixels as a single texel
-        for (Pixel i = from; i < to; i++) {
-            dst[i] = palette[bbuf[i] == 0xFF ? mbuf[i] : bbuf[i]];
-        }
+        denise.scalarKernels ? colorizeScalar(dst, from, to) : colorize(dst, from, to);
 
     } else {
 
@@ -111,7 +111,15 @@ public:
 
     PixelEngine& operator= (const PixelEngine& other) {
 
-        CLONE_ARRAY(colorSpace)
+        // The color space only needs to be updated if the settings differ
+        if (config.palette != other.config.palette ||
+            config.brightness != other.config.brightness ||
+            config.contrast != other.config.contrast ||
+            config.saturation != other.config.saturation) {
+
+            CLONE(config)
+            CLONE_ARRAY(colorSpace)
+        }
         CLONE(colChanges)
         CLONE_ARRAY(color)
         CLONE(hamMode)
@@ -255,6 +263,7 @@ public:
 private:
     
     void colorize(Texel *dst, Pixel from, Pixel to);
+    void colorizeScalar(Texel *dst, Pixel from, Pixel to);
     void colorizeSHRES(Texel *dst, Pixel from, Pixel to);
     void colorizeHAM(Texel *dst, Pixel from, Pixel to, AmigaColor& ham);
     
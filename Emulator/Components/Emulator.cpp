@@ -56,6 +56,19 @@ Emulator::launch(const void *listener, Callback *func)
     Thread::launch();
 }
 
+void
+Emulator::attach()
+{
+    // Initialize the emulator if needed
+    if (!isInitialized()) initialize();
+
+    // Disable the message queue of the run-ahead instance
+    ahead.msgQueue.disable();
+
+    // Drive the emulator from the calling thread
+    Thread::attach();
+}
+
 void
 Emulator::initialize()
 {
@@ -75,6 +88,9 @@ Emulator::initialize()
 
     // Get the runahead instance up-to-date
     ahead = main;
+    main.mem.markAsClean();
+    for (isize i = 0; i < 4; i++) main.df[i]->markAsClean();
+    for (isize i = 0; i < 4; i++) main.hd[i]->markAsClean();
 
     // Switch state
     state = newState = STATE_OFF;
@@ -597,9 +613,19 @@ Emulator::computeFrame()
             // Recreate the run-ahead instance if necessary
             if (isDirty || RUA_ON_STEROIDS) recreateRunAheadInstance();
 
+            // Check if both instances have computed the same frame
+            if (RUA_TEXTURE_CHECK) verifyRunAheadTexture();
+
             // Run the runahead instance
             ahead.computeFrame();
 
+            // Remember the frame for a later comparison
+            if (RUA_TEXTURE_CHECK) {
+
+                auto &texture = ahead.denise.pixelEngine.getStableBuffer();
+                if (texture.nr > aheadOrigin) aheadTextures[texture.nr] = textureChecksum(ahead);
+            }
+
         } catch (StateChangeException &) {
 
             isDirty = true;
@@ -621,6 +647,15 @@ Emulator::cloneRunAheadInstance()
     // Recreate the runahead instance from scratch
     ahead = main; isDirty = false;
 
+    // Forget all frames that have been computed with outdated inputs
+    aheadTextures.clear();
+    aheadOrigin = ahead.agnus.pos.frame;
+
+    // Start tracking modifications from here
+    main.mem.markAsClean();
+    for (isize i = 0; i < 4; i++) main.df[i]->markAsClean();
+    for (isize i = 0; i < 4; i++) main.hd[i]->markAsClean();
+
     if (RUA_CHECKSUM && ahead != main) {
 
         main.diff(ahead);
@@ -628,6 +663,44 @@ Emulator::cloneRunAheadInstance()
     }
 }
 
+u64
+Emulator::textureChecksum(Amiga &amiga) const
+{
+    auto &texture = amiga.denise.pixelEngine.getStableBuffer();
+
+    // Only consider the lines that have been drawn in this frame
+    auto first = VBLANK_CNT;
+    auto last =
+    amiga.agnus.isPAL() ?
+    (texture.lof ? VPOS_MAX_PAL_LF : VPOS_MAX_PAL_SF) :
+    (texture.lof ? VPOS_MAX_NTSC_LF : VPOS_MAX_NTSC_SF);
+
+    auto *ptr = (u8 *)(texture.pixels.ptr + first * HPIXELS);
+    return util::fnv64(ptr, (last - first + 1) * HPIXELS * isizeof(Texel));
+}
+
+void
+Emulator::verifyRunAheadTexture()
+{
+    /* Once the run-ahead instance has been created, it computes the same
+     * frames as the main instance, only earlier. Hence, as long as no external
+     * event has been processed, the main instance must produce the exact same
+     * texture the run-ahead instance has produced for this frame.
+     */
+    auto &texture = main.denise.pixelEngine.getStableBuffer();
+
+    if (auto it = aheadTextures.find(texture.nr); it != aheadTextures.end()) {
+
+        debug(RUA_DEBUG, "Verifying frame %lld\n", (long long)texture.nr);
+
+        if (it->second != textureChecksum(main)) {
+
+            fatal("Run-ahead instance computed a different frame (%lld)", (long long)texture.nr);
+        }
+        aheadTextures.erase(aheadTextures.begin(), ++it);
+    }
+}
+
 void
 Emulator::recreateRunAheadInstance()
 {
@@ -641,12 +714,12 @@ Emulator::recreateRunAheadInstance()
         cloneRunAheadInstance();
     }
 
-    // Advance to the proper frame
+    // Advance to the proper frame (the intermediate frames are never shown)
     if (RUA_DEBUG) {
         util::StopWatch watch("Run-ahead: Fast-forward");
-        ahead.fastForward(config.runAhead - 1);
+        ahead.fastForward(config.runAhead - 1, false);
     } else {
-        ahead.fastForward(config.runAhead - 1);
+        ahead.fastForward(config.runAhead - 1, false);
     }
 }
 
@@ -682,6 +755,7 @@ Emulator::getDebugVariable(DebugFlag flag)
         case FLAG_RUA_DEBUG:        return RUA_DEBUG;
         case FLAG_RUA_CHECKSUM:     return RUA_CHECKSUM;
         case FLAG_RUA_ON_STEROIDS:  return RUA_ON_STEROIDS;
+        case FLAG_RUA_TEXTURE_CHECK: return RUA_TEXTURE_CHECK;
 
         case FLAG_CPU_DEBUG:        return CPU_DEBUG;
         case FLAG_CST_DEBUG:        return CST_DEBUG;
@@ -809,6 +883,12 @@ Emulator::setDebugVariable(DebugFlag flag, bool val)
         case FLAG_QUEUE_DEBUG:      QUEUE_DEBUG = val; break;
         case FLAG_SNP_DEBUG:        SNP_DEBUG = val; break;
 
+            // Run ahead
+        case FLAG_RUA_DEBUG:        RUA_DEBUG = val; break;
+        case FLAG_RUA_CHECKSUM:     RUA_CHECKSUM = val; break;
+        case FLAG_RUA_ON_STEROIDS:  RUA_ON_STEROIDS = val; break;
+        case FLAG_RUA_TEXTURE_CHECK: RUA_TEXTURE_CHECK = val; break;
+
             // CPU
         case FLAG_CPU_DEBUG:        CPU_DEBUG = val; break;
         case FLAG_CST_DEBUG:        CST_DEBUG = val; break;
@@ -34,6 +34,12 @@ public:
     // Indicates if the run-ahead instance needs to be updated
     bool isDirty = true;
 
+    // Texture checksums of frames computed by the run-ahead instance
+    std::map<i64, u64> aheadTextures;
+
+    // The frame in which the run-ahead instance has been recreated
+    i64 aheadOrigin = 0;
+
 public:
 
     // User default settings
@@ -58,6 +64,9 @@ public:
     // Launches the emulator thread
     void launch(const void *listener, Callback *func);
 
+    // Lets the calling thread drive the emulator (no emulator thread is launched)
+    void attach();
+
     // Initializes all components
     void initialize();
 
@@ -157,6 +166,12 @@ private:
     // Clones the run-ahead instance and fast forwards it to the proper frame
     void recreateRunAheadInstance();
 
+    // Computes a checksum of the stable texture of an Amiga instance
+    u64 textureChecksum(Amiga &amiga) const;
+
+    // Compares the latest frame of the main instance with the run-ahead frames
+    void verifyRunAheadTexture();
+
 
     //
     // Execution control
@@ -38,6 +38,7 @@ enum_long(DEBUG_FLAG)
     FLAG_RUA_DEBUG,         ///< Inform about run-ahead activity
     FLAG_RUA_CHECKSUM,      ///< Verify the integrity of the run-ahead instance
     FLAG_RUA_ON_STEROIDS,   ///< Update the run-ahead instance in every frame
+    FLAG_RUA_TEXTURE_CHECK, ///< Verify the frames computed by the run-ahead instance
 
     // CPU
     FLAG_CPU_DEBUG,        ///< CPU
@@ -180,6 +181,7 @@ struct DebugFlagEnum : util::Reflection<DebugFlagEnum, DebugFlag>
             case FLAG_RUA_DEBUG:        return "RUA_DEBUG";
             case FLAG_RUA_CHECKSUM:     return "RUA_CHECKSUM";
             case FLAG_RUA_ON_STEROIDS:  return "RUA_ON_STEROIDS";
+            case FLAG_RUA_TEXTURE_CHECK: return "RUA_TEXTURE_CHECK";
 
                 // CPU
             case FLAG_CPU_DEBUG:        return "CPU_DEBUG";
@@ -92,6 +92,38 @@ Memory::_dump(Category category, std::ostream& os) const
             }
         }
     }
+
+    if (category == Category::Stats && !PROFILE_MEMORY) {
+
+        os << "Memory profiling is disabled (see PROFILE_MEMORY in config.h)" << std::endl;
+    }
+
+    if (category == Category::Stats && PROFILE_MEMORY) {
+
+        os << std::setfill(' ') << std::left << std::setw(10) << "Bank";
+        os << std::setw(14) << "Source";
+        os << std::right << std::setw(12) << "Reads";
+        os << std::right << std::setw(12) << "Fetches";
+        os << std::right << std::setw(12) << "Writes";
+        os << std::right << std::setw(12) << "DMA reads";
+        os << std::right << std::setw(12) << "DMA writes";
+        os << std::right << std::setw(12) << "Wait cycles" << std::endl;
+
+        for (isize i = 0; i < 256; i++) {
+
+            auto &p = pageProfile[i];
+            if (!p.cpuReads && !p.cpuFetches && !p.cpuWrites && !p.agnusReads && !p.agnusWrites) continue;
+
+            os << util::hex((u8)i) << "0000  ";
+            os << std::left << std::setw(14) << MemorySourceEnum::key(cpuMemSrc[i]);
+            os << std::right << std::setw(12) << p.cpuReads;
+            os << std::right << std::setw(12) << p.cpuFetches;
+            os << std::right << std::setw(12) << p.cpuWrites;
+            os << std::right << std::setw(12) << p.agnusReads;
+            os << std::right << std::setw(12) << p.agnusWrites;
+            os << std::right << std::setw(12) << p.waitCycles << std::endl;
+        }
+    }
 }
 
 void
@@ -304,6 +336,7 @@ Memory::_didReset(bool hard)
 
     // Initialize statistical counters
     clearStats();
+    clearProfile();
 }
 
 void
@@ -311,24 +344,13 @@ Memory::operator << (SerChecker &worker)
 {
     serialize(worker);
 
-    if (config.chipSize) {
-        for (isize i = 0; i < config.chipSize; i++) worker << chip[i];
-    }
-    if (config.slowSize) {
-        for (isize i = 0; i < config.slowSize; i++) worker << slow[i];
-    }
-    if (config.fastSize) {
-        for (isize i = 0; i < config.fastSize; i++) worker << fast[i];
-    }
-    if (romAllocator.size) {
-        for (isize i = 0; i < romAllocator.size; i++) worker << rom[i];
-    }
-    if (womAllocator.size) {
-        for (isize i = 0; i < womAllocator.size; i++) worker << wom[i];
-    }
-    if (extAllocator.size) {
-        for (isize i = 0; i < extAllocator.size; i++) worker << ext[i];
-    }
+    // Hash all memory blocks (big blocks are hashed in parallel)
+    if (config.chipSize) worker.block(chip, config.chipSize);
+    if (config.slowSize) worker.block(slow, config.slowSize);
+    if (config.fastSize) worker.block(fast, config.fastSize);
+    if (romAllocator.size) worker.block(rom, romAllocator.size);
+    if (womAllocator.size) worker.block(wom, womAllocator.size);
+    if (extAllocator.size) worker.block(ext, extAllocator.size);
 }
 
 void
@@ -401,6 +423,9 @@ Memory::operator << (SerReader &worker)
     worker.copy(chip, chipSize);
     worker.copy(slow, slowSize);
     worker.copy(fast, fastSize);
+
+    markAsDirty();
+    updateCpuPageTable();
 }
 
 void
@@ -511,46 +536,46 @@ void
 Memory::allocChip(i32 bytes, bool update)
 {
     config.chipSize = bytes;
-    alloc(chipAllocator, bytes, chipMask, update);
+    alloc(chipAllocator, chipDirty, bytes, chipMask, update);
 }
 
 void
 Memory::allocSlow(i32 bytes, bool update)
 {
     config.slowSize = bytes;
-    alloc(slowAllocator, bytes, update);
+    alloc(slowAllocator, slowDirty, bytes, update);
 }
 
 void
 Memory::allocFast(i32 bytes, bool update)
 {
     config.fastSize = bytes;
-    alloc(fastAllocator, bytes, update);
+    alloc(fastAllocator, fastDirty, bytes, update);
 }
 
 void
 Memory::allocRom(i32 bytes, bool update)
 {
     config.romSize = bytes;
-    alloc(romAllocator, bytes, romMask, update);
+    alloc(romAllocator, romDirty, bytes, romMask, update);
 }
 
 void
 Memory::allocWom(i32 bytes, bool update)
 {
     config.womSize = bytes;
-    alloc(womAllocator, bytes, womMask, update);
+    alloc(womAllocator, womDirty, bytes, womMask, update);
 }
 
 void
 Memory::allocExt(i32 bytes, bool update)
 {
     config.extSize = bytes;
-    alloc(extAllocator, bytes, extMask, update);
+    alloc(extAllocator, extDirty, bytes, extMask, update);
 }
 
 void
-Memory::alloc(Allocator<u8> &allocator, isize bytes, bool update)
+Memory::alloc(Allocator<u8> &allocator, Buffer<bool> &dirty, isize bytes, bool update)
 {
     // Only proceed if memory layout will change
     if (bytes == allocator.size) return;
@@ -558,18 +583,73 @@ Memory::alloc(Allocator<u8> &allocator, isize bytes, bool update)
     // Allocate memory
     allocator.alloc(bytes);
 
+    // Set up the dirty-page map
+    dirty.init((bytes + DIRTY_PAGE_SIZE - 1) >> DIRTY_PAGE_SHIFT, true);
+
     // Update the memory source tables if requested
     if (update) updateMemSrcTables();
 }
 
 void
-Memory::alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update)
+Memory::alloc(Allocator<u8> &allocator, Buffer<bool> &dirty, isize bytes, u32 &mask, bool update)
 {
     // Set the memory mask
     mask = bytes ? u32(bytes - 1) : 0;
 
     // Allocate
-    alloc(allocator, bytes, update);
+    alloc(allocator, dirty, bytes, update);
+}
+
+void
+Memory::markAsDirty()
+{
+    romDirty.clear(true);
+    womDirty.clear(true);
+    extDirty.clear(true);
+    chipDirty.clear(true);
+    slowDirty.clear(true);
+    fastDirty.clear(true);
+
+    // Memory has been modified in bulk. Discard all cached instruction words
+    cpu.flushInstrCache();
+}
+
+void
+Memory::markAsClean()
+{
+    romDirty.clear(false);
+    womDirty.clear(false);
+    extDirty.clear(false);
+    chipDirty.clear(false);
+    slowDirty.clear(false);
+    fastDirty.clear(false);
+}
+
+void
+Memory::clone(Allocator<u8> &allocator, Buffer<bool> &dirty,
+              const Allocator<u8> &other, const Buffer<bool> &otherDirty)
+{
+    assert(otherDirty.size == (other.size + DIRTY_PAGE_SIZE - 1) >> DIRTY_PAGE_SHIFT);
+
+    if (allocator.size != other.size) {
+
+        // The memory layout differs. Clone all pages
+        allocator = other;
+        dirty.init(otherDirty.size, false);
+        return;
+    }
+
+    // Clone all pages that have been modified in either instance
+    for (isize i = 0; i < dirty.size; i++) {
+
+        if (dirty[i] || otherDirty[i]) {
+
+            auto offset = i << DIRTY_PAGE_SHIFT;
+            auto count = std::min(isize(DIRTY_PAGE_SIZE), other.size - offset);
+            std::memcpy(allocator.ptr + offset, other.ptr + offset, count);
+            dirty[i] = false;
+        }
+    }
 }
 
 void
@@ -604,12 +684,14 @@ Memory::fillRamWithInitPattern()
         default:
             break;
     }
+
+    markAsDirty();
 }
 
 RomTraits &
 Memory::getRomTraits(u32 crc)
 {
-    static RomTraits fallback;
+    static thread_local RomTraits fallback;
 
     // Crawl through the Rom database
     for (auto &traits : roms) if (traits.crc == crc) return traits;
@@ -738,6 +820,8 @@ Memory::loadRom(MediaFile &file)
         // Remove extended Rom (if any)
         deleteExt();
 
+        markAsDirty();
+
     } catch (...) { try {
 
         auto &extFile = dynamic_cast<ExtendedRomFile &>(file);
@@ -748,6 +832,8 @@ Memory::loadRom(MediaFile &file)
         // Load Rom
         extFile.flash(ext);
 
+        markAsDirty();
+
     } catch (...) {
 
         throw Error(ERROR_FILE_TYPE_MISMATCH);
@@ -773,13 +859,15 @@ Memory::loadExt(MediaFile &file)
 {
     try {
 
-        RomFile &extFile = dynamic_cast<RomFile &>(file);
+        auto &extFile = dynamic_cast<ExtendedRomFile &>(file);
 
         // Allocate memory
         allocExt((i32)extFile.data.size);
 
         // Load Rom
-        file.flash(ext);
+        extFile.flash(ext);
+
+        markAsDirty();
 
     } catch (...) {
 
@@ -854,6 +942,7 @@ Memory::patchExpansionLib()
 
                     W32BE(rom + i, 0x426f0004);
                     W16BE(rom + i + 22, 0x0000);
+                    markAsDirty();
                     return;
                 }
             }
@@ -1001,9 +1090,59 @@ Memory::updateCpuMemSrcTable()
     // Expansion boards
     zorro.updateMemSrcTables();
 
+    updateCpuPageTable();
+
     msgQueue.put(MSG_MEM_LAYOUT);
 }
 
+void
+Memory::updateCpuPageTable()
+{
+    // The cached instruction words may belong to a different memory layout
+    cpu.flushInstrCache();
+
+    for (isize i = 0; i <= 0xFF; i++) {
+
+        u32 addr = u32(i << 16);
+        auto &page = cpuPage[i];
+        page = CpuPage { };
+
+        switch (cpuMemSrc[i]) {
+
+            case MEM_FAST:
+
+                page.read = page.write = fast + (addr - FAST_RAM_STRT);
+                page.dirty = fastDirty.ptr + ((addr - FAST_RAM_STRT) >> DIRTY_PAGE_SHIFT);
+                page.reads = &stats.fastReads.raw;
+                page.writes = &stats.fastWrites.raw;
+                break;
+
+            case MEM_ROM:
+            case MEM_ROM_MIRROR:
+
+                // Small Roms (e.g., the A1000 Boot Rom) are mirrored within a bank
+                if (romMask >= 0xFFFF) page.read = rom + (addr & romMask);
+                page.reads = &stats.kickReads.raw;
+                break;
+
+            case MEM_WOM:
+
+                if (womMask >= 0xFFFF) page.read = wom + (addr & womMask);
+                page.reads = &stats.kickReads.raw;
+                break;
+
+            case MEM_EXT:
+
+                if (extMask >= 0xFFFF) page.read = ext + (addr & extMask);
+                page.reads = &stats.kickReads.raw;
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
 void
 Memory::updateAgnusMemSrcTable()
 {
@@ -1214,10 +1353,6 @@ Memory::peek8 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 template<> u16
 Memory::peek16 <ACCESSOR_CPU, MEM_FAST> (u32 addr)
 {
-    if (!((addr - FAST_RAM_STRT) < (u32)config.fastSize)) {
-        printf("addr = %x (start: %x size: %x)\n", addr, FAST_RAM_STRT, (u32)config.fastSize);
-    }
-    
     ASSERT_FAST_ADDR(addr);
     
     stats.fastReads.raw++;
@@ -1454,7 +1589,20 @@ template<> u8
 Memory::peek8 <ACCESSOR_CPU> (u32 addr)
 {
     addr &= 0xFFFFFF;
-    
+
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileCpuRead(addr);
+
+    // Read directly from host memory if possible
+    if (auto &page = cpuPage[addr >> 16]; page.read) {
+
+        (*page.reads)++;
+        return R8BE(page.read + (addr & 0xFFFF));
+    }
+
+    // Let Agnus catch up if it lags behind the CPU (decoupled overclocking)
+    if (cpu.lag) cpu.catchUp();
+
     switch (cpuMemSrc[addr >> 16]) {
             
         case MEM_NONE:          return peek8 <ACCESSOR_CPU, MEM_NONE>     (addr);
@@ -1484,6 +1632,19 @@ Memory::peek16 <ACCESSOR_CPU> (u32 addr)
 {
     addr &= 0xFFFFFF;
 
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileCpuRead(addr);
+
+    // Read directly from host memory if possible
+    if (auto &page = cpuPage[addr >> 16]; page.read && (addr & 0xFFFF) != 0xFFFF) {
+
+        (*page.reads)++;
+        return R16BE(page.read + (addr & 0xFFFF));
+    }
+
+    // Let Agnus catch up if it lags behind the CPU (decoupled overclocking)
+    if (cpu.lag) cpu.catchUp();
+
     switch (cpuMemSrc[addr >> 16]) {
             
         case MEM_NONE:          return peek16 <ACCESSOR_CPU, MEM_NONE>     (addr);
@@ -1617,6 +1778,9 @@ Memory::peek16 <ACCESSOR_AGNUS> (u32 addr)
 {
     addr &= agnus.ptrMask;
 
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileAgnusRead(addr);
+
     switch (agnusMemSrc[addr >> 16]) {
             
         case MEM_NONE:        return peek16 <ACCESSOR_AGNUS, MEM_NONE> (addr);
@@ -1737,6 +1901,7 @@ Memory::poke8 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u8 value)
     
     stats.fastWrites.raw++;
     WRITE_FAST_8(addr, value);
+    cpu.invalidateInstrCache(addr);
 }
 
 template <> void
@@ -1746,6 +1911,8 @@ Memory::poke16 <ACCESSOR_CPU, MEM_FAST> (u32 addr, u16 value)
     
     stats.fastWrites.raw++;
     WRITE_FAST_16(addr, value);
+    cpu.invalidateInstrCache(addr);
+    cpu.invalidateInstrCache(addr + 1);
 }
 
 template <> void
@@ -1906,7 +2073,23 @@ template<> void
 Memory::poke8 <ACCESSOR_CPU> (u32 addr, u8 value)
 {
     addr &= 0xFFFFFF;
-    
+
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileCpuWrite(addr);
+
+    // Write directly into host memory if possible
+    if (auto &page = cpuPage[addr >> 16]; page.write) {
+
+        (*page.writes)++;
+        W8BE(page.write + (addr & 0xFFFF), value);
+        page.dirty[(addr & 0xFFFF) >> DIRTY_PAGE_SHIFT] = true;
+        cpu.invalidateInstrCache(addr);
+        return;
+    }
+
+    // Let Agnus catch up if it lags behind the CPU (decoupled overclocking)
+    if (cpu.lag) cpu.catchUp();
+
     switch (cpuMemSrc[addr >> 16]) {
             
         case MEM_NONE:          poke8 <ACCESSOR_CPU, MEM_NONE>     (addr, value); return;
@@ -1935,7 +2118,24 @@ template<> void
 Memory::poke16 <ACCESSOR_CPU> (u32 addr, u16 value)
 {
     addr &= 0xFFFFFF;
-    
+
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileCpuWrite(addr);
+
+    // Write directly into host memory if possible
+    if (auto &page = cpuPage[addr >> 16]; page.write && (addr & 0xFFFF) != 0xFFFF) {
+
+        (*page.writes)++;
+        W16BE(page.write + (addr & 0xFFFF), value);
+        page.dirty[(addr & 0xFFFF) >> DIRTY_PAGE_SHIFT] = true;
+        cpu.invalidateInstrCache(addr);
+        cpu.invalidateInstrCache(addr + 1);
+        return;
+    }
+
+    // Let Agnus catch up if it lags behind the CPU (decoupled overclocking)
+    if (cpu.lag) cpu.catchUp();
+
     switch (cpuMemSrc[addr >> 16]) {
             
         case MEM_NONE:          poke16 <ACCESSOR_CPU, MEM_NONE>     (addr, value); return;
@@ -1993,6 +2193,9 @@ template<> void
 Memory::poke16 <ACCESSOR_AGNUS> (u32 addr, u16 value)
 {
     addr &= agnus.ptrMask;
+
+    // Record the access (profiling)
+    if constexpr (PROFILE_MEMORY) profileAgnusWrite(addr);
     
     switch (agnusMemSrc[addr >> 16]) {
             
@@ -2771,6 +2974,7 @@ void
 Memory::patch(u32 addr, u8 value)
 {
     addr &= 0xFFFFFF;
+    cpu.invalidateInstrCache(addr);
     
     switch (cpuMemSrc[addr >> 16]) {
             
@@ -2823,6 +3027,105 @@ Memory::eofHandler()
     (void)getStats();
 }
 
+const MemPageProfile &
+Memory::getPageProfile(isize bank) const
+{
+    static const MemPageProfile none = { };
+
+    return bank >= 0 && bank < 256 ? pageProfile[bank] : none;
+}
+
+void
+Memory::clearProfile()
+{
+    for (isize i = 0; i < 256; i++) pageProfile[i] = { };
+}
+
+void
+Memory::exportProfile(std::ostream &os, bool json) const
+{
+    // Only banks that have been accessed are exported
+    auto accessed = [](const MemPageProfile &p) {
+        return p.cpuReads || p.cpuFetches || p.cpuWrites || p.agnusReads || p.agnusWrites;
+    };
+
+    if (json) {
+
+        os << "[" << std::endl;
+
+        bool first = true;
+        for (isize i = 0; i < 256; i++) {
+
+            auto &p = pageProfile[i];
+            if (!accessed(p)) continue;
+
+            os << (first ? "" : ",\n");
+            os << "  { \"bank\": " << i;
+            os << ", \"source\": \"" << MemorySourceEnum::key(cpuMemSrc[i]) << "\"";
+            os << ", \"cpuReads\": " << p.cpuReads;
+            os << ", \"cpuFetches\": " << p.cpuFetches;
+            os << ", \"cpuWrites\": " << p.cpuWrites;
+            os << ", \"agnusReads\": " << p.agnusReads;
+            os << ", \"agnusWrites\": " << p.agnusWrites;
+            os << ", \"waitCycles\": " << p.waitCycles << " }";
+            first = false;
+        }
+        os << (first ? "" : "\n") << "]" << std::endl;
+
+    } else {
+
+        os << "bank,source,cpuReads,cpuFetches,cpuWrites,agnusReads,agnusWrites,waitCycles" << std::endl;
+
+        for (isize i = 0; i < 256; i++) {
+
+            auto &p = pageProfile[i];
+            if (!accessed(p)) continue;
+
+            os << i << "," << MemorySourceEnum::key(cpuMemSrc[i]) << ",";
+            os << p.cpuReads << "," << p.cpuFetches << "," << p.cpuWrites << ",";
+            os << p.agnusReads << "," << p.agnusWrites << "," << p.waitCycles << std::endl;
+        }
+    }
+}
+
+void
+Memory::profileCpuRead(u32 addr)
+{
+    profiledBank = addr >> 16;
+
+    // Distinguish instruction fetches from data reads by the function code
+    if (cpu.readFC() & 2) {
+        pageProfile[profiledBank].cpuFetches++;
+    } else {
+        pageProfile[profiledBank].cpuReads++;
+    }
+}
+
+void
+Memory::profileCpuWrite(u32 addr)
+{
+    profiledBank = addr >> 16;
+    pageProfile[profiledBank].cpuWrites++;
+}
+
+void
+Memory::profileAgnusRead(u32 addr)
+{
+    pageProfile[addr >> 16].agnusReads++;
+}
+
+void
+Memory::profileAgnusWrite(u32 addr)
+{
+    pageProfile[addr >> 16].agnusWrites++;
+}
+
+void
+Memory::profileWaitCycles(DMACycle cycles)
+{
+    pageProfile[profiledBank].waitCycles += cycles;
+}
+
 std::vector <u32>
 Memory::search(u64 pattern, isize bytes)
 {
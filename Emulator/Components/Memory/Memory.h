@@ -23,6 +23,10 @@ namespace vamiga {
 #define SLOW_RAM_STRT 0xC00000
 #define FAST_RAM_STRT ramExpansion.getBaseAddr()
 
+// Granularity of the dirty-page maps (4 KB pages)
+#define DIRTY_PAGE_SHIFT 12
+#define DIRTY_PAGE_SIZE (1 << DIRTY_PAGE_SHIFT)
+
 // Verifies address ranges
 #define ASSERT_CHIP_ADDR(x) \
 assert(((x) % config.chipSize) == ((x) & chipMask));
@@ -77,29 +81,32 @@ assert((x) >= 0xE80000 && (x) <= 0xE8FFFF);
 // Writing
 //
 
+// Marks the page containing a certain memory offset as modified
+#define MARK_DIRTY(map,x)   { (map).ptr[(x) >> DIRTY_PAGE_SHIFT] = true; }
+
 // Writes a value into Chip RAM in big endian format
-#define WRITE_CHIP_8(x,y)   W8BE (chip + ((x) & chipMask), (y))
-#define WRITE_CHIP_16(x,y)  W16BE(chip + ((x) & chipMask), (y))
+#define WRITE_CHIP_8(x,y)   { W8BE (chip + ((x) & chipMask), (y)); MARK_DIRTY(chipDirty, (x) & chipMask); }
+#define WRITE_CHIP_16(x,y)  { W16BE(chip + ((x) & chipMask), (y)); MARK_DIRTY(chipDirty, (x) & chipMask); }
 
 // Writes a value into Fast RAM in big endian format
-#define WRITE_FAST_8(x,y)   W8BE (fast + ((x) - FAST_RAM_STRT), (y))
-#define WRITE_FAST_16(x,y)  W16BE(fast + ((x) - FAST_RAM_STRT), (y))
+#define WRITE_FAST_8(x,y)   { W8BE (fast + ((x) - FAST_RAM_STRT), (y)); MARK_DIRTY(fastDirty, (x) - FAST_RAM_STRT); }
+#define WRITE_FAST_16(x,y)  { W16BE(fast + ((x) - FAST_RAM_STRT), (y)); MARK_DIRTY(fastDirty, (x) - FAST_RAM_STRT); }
 
 // Writes a value into Slow RAM in big endian format
-#define WRITE_SLOW_8(x,y)   W8BE (slow + ((x) - SLOW_RAM_STRT), (y))
-#define WRITE_SLOW_16(x,y)  W16BE(slow + ((x) - SLOW_RAM_STRT), (y))
+#define WRITE_SLOW_8(x,y)   { W8BE (slow + ((x) - SLOW_RAM_STRT), (y)); MARK_DIRTY(slowDirty, (x) - SLOW_RAM_STRT); }
+#define WRITE_SLOW_16(x,y)  { W16BE(slow + ((x) - SLOW_RAM_STRT), (y)); MARK_DIRTY(slowDirty, (x) - SLOW_RAM_STRT); }
 
 // Writes a value into Boot ROM or Kickstart ROM in big endian format
-#define WRITE_ROM_8(x,y)    W8BE (rom + ((x) & romMask), (y))
-#define WRITE_ROM_16(x,y)   W16BE(rom + ((x) & romMask), (y))
+#define WRITE_ROM_8(x,y)    { W8BE (rom + ((x) & romMask), (y)); MARK_DIRTY(romDirty, (x) & romMask); }
+#define WRITE_ROM_16(x,y)   { W16BE(rom + ((x) & romMask), (y)); MARK_DIRTY(romDirty, (x) & romMask); }
 
 // Writes a value into Kickstart WOM in big endian format
-#define WRITE_WOM_8(x,y)    W8BE (wom + ((x) & womMask), (y))
-#define WRITE_WOM_16(x,y)   W16BE(wom + ((x) & womMask), (y))
+#define WRITE_WOM_8(x,y)    { W8BE (wom + ((x) & womMask), (y)); MARK_DIRTY(womDirty, (x) & womMask); }
+#define WRITE_WOM_16(x,y)   { W16BE(wom + ((x) & womMask), (y)); MARK_DIRTY(womDirty, (x) & womMask); }
 
 // Writes a value into Extended ROM in big endian format
-#define WRITE_EXT_8(x,y)    W8BE (ext + ((x) & extMask), (y))
-#define WRITE_EXT_16(x,y)   W16BE(ext + ((x) & extMask), (y))
+#define WRITE_EXT_8(x,y)    { W8BE (ext + ((x) & extMask), (y)); MARK_DIRTY(extDirty, (x) & extMask); }
+#define WRITE_EXT_16(x,y)   { W16BE(ext + ((x) & extMask), (y)); MARK_DIRTY(extDirty, (x) & extMask); }
 
 
 class Memory : public SubComponent, public Inspectable<MemInfo, MemStats> {
@@ -191,6 +198,18 @@ public:
     Allocator<u8> slowAllocator = Allocator(slow);
     Allocator<u8> fastAllocator = Allocator(fast);
 
+    /* Dirty-page maps. Each memory area is divided into pages of size
+     * DIRTY_PAGE_SIZE. A page is marked dirty whenever it is written to. The
+     * maps are used to keep the run-ahead instance up to date by copying
+     * only those pages that have been modified since the last clone.
+     */
+    Buffer<bool> romDirty;
+    Buffer<bool> womDirty;
+    Buffer<bool> extDirty;
+    Buffer<bool> chipDirty;
+    Buffer<bool> slowDirty;
+    Buffer<bool> fastDirty;
+
     u32 romMask = 0;
     u32 womMask = 0;
     u32 extMask = 0;
@@ -211,6 +230,34 @@ public:
     MemorySource cpuMemSrc[256];
     MemorySource agnusMemSrc[256];
 
+    /* For each bank, the CPU page table provides direct pointers into host
+     * memory. It is consulted first by the CPU read and write functions. If
+     * a pointer is null, the access is carried out via the cpuMemSrc table.
+     * Only Fast Ram and the Roms are accessed directly, because they are
+     * not affected by bus contention and have no side effects.
+     * See also: updateCpuPageTable()
+     */
+    struct CpuPage {
+
+        // Host memory seen at the start of the bank (read and write access)
+        u8 *read;
+        u8 *write;
+
+        // Dirty-page map entry of the start of the bank
+        bool *dirty;
+
+        // Statistical counters
+        isize *reads;
+        isize *writes;
+    };
+    CpuPage cpuPage[256] = { };
+
+    // Access histogram of all banks (if PROFILE_MEMORY is set in config.h)
+    MemPageProfile pageProfile[256] = { };
+
+    // The bank accessed by the most recent CPU access (profiling)
+    isize profiledBank = 0;
+
     // The last value on the data bus
     u16 dataBus;
 
@@ -229,12 +276,12 @@ public:
 
     Memory& operator= (const Memory& other) {
 
-        CLONE(romAllocator)
-        CLONE(womAllocator)
-        CLONE(extAllocator)
-        CLONE(chipAllocator)
-        CLONE(slowAllocator)
-        CLONE(fastAllocator)
+        clone(romAllocator, romDirty, other.romAllocator, other.romDirty);
+        clone(womAllocator, womDirty, other.womAllocator, other.womDirty);
+        clone(extAllocator, extDirty, other.extAllocator, other.extDirty);
+        clone(chipAllocator, chipDirty, other.chipAllocator, other.chipDirty);
+        clone(slowAllocator, slowDirty, other.slowAllocator, other.slowDirty);
+        clone(fastAllocator, fastDirty, other.fastAllocator, other.fastDirty);
 
         CLONE(womIsLocked)
         CLONE_ARRAY(cpuMemSrc)
@@ -247,6 +294,8 @@ public:
         CLONE(chipMask)
 
         CLONE(config)
+
+        updateCpuPageTable();
         
         return *this;
     }
@@ -364,8 +413,27 @@ public:
 
 private:
     
-    void alloc(Allocator<u8> &allocator, isize bytes, bool update);
-    void alloc(Allocator<u8> &allocator, isize bytes, u32 &mask, bool update);
+    void alloc(Allocator<u8> &allocator, Buffer<bool> &dirty, isize bytes, bool update);
+    void alloc(Allocator<u8> &allocator, Buffer<bool> &dirty, isize bytes, u32 &mask, bool update);
+
+
+    //
+    // Tracking modified pages
+    //
+
+public:
+
+    // Marks all pages as modified
+    void markAsDirty();
+
+    // Marks all pages as unmodified
+    void markAsClean();
+
+private:
+
+    // Copies all pages that have been modified on either side
+    void clone(Allocator<u8> &allocator, Buffer<bool> &dirty,
+               const Allocator<u8> &other, const Buffer<bool> &otherDirty);
 
 
     //
@@ -414,9 +482,9 @@ public:
     bool hasExt() const { return ext != nullptr; }
 
     // Erases an installed Rom
-    void eraseRom() { std::memset(rom, 0, config.romSize); }
-    void eraseWom() { std::memset(wom, 0, config.womSize); }
-    void eraseExt() { std::memset(ext, 0, config.extSize); }
+    void eraseRom() { std::memset(rom, 0, config.romSize); romDirty.clear(true); }
+    void eraseWom() { std::memset(wom, 0, config.womSize); womDirty.clear(true); }
+    void eraseExt() { std::memset(ext, 0, config.extSize); extDirty.clear(true); }
     
     // Installs a Boot Rom or Kickstart Rom
     void loadRom(class MediaFile &file) throws;
@@ -466,6 +534,9 @@ private:
     void updateCpuMemSrcTable();
     void updateAgnusMemSrcTable();
 
+    // Derives the CPU page table from the CPU memory source table
+    void updateCpuPageTable();
+
     // Checks whether Agnus is able to access Slow Ram
     bool slowRamIsMirroredIn() const;
 
@@ -551,6 +622,31 @@ public:
     void eofHandler();
 
 
+    //
+    // Profiling memory accesses
+    //
+
+public:
+
+    // Returns the access histogram of a single bank
+    const MemPageProfile &getPageProfile(isize bank) const;
+
+    // Deletes all recorded profiling data
+    void clearProfile();
+
+    // Exports the access histogram in CSV or JSON format
+    void exportProfile(std::ostream &os, bool json = false) const;
+
+    // Records a memory access (called by the peek and poke functions)
+    void profileCpuRead(u32 addr);
+    void profileCpuWrite(u32 addr);
+    void profileAgnusRead(u32 addr);
+    void profileAgnusWrite(u32 addr);
+
+    // Charges the DMA cycles the CPU has been blocked to the accessed bank
+    void profileWaitCycles(DMACycle cycles);
+
+
     //
     // Debugging
     //
@@ -259,3 +259,19 @@ typedef struct
     struct { isize raw; double accumulated; } kickWrites;
 }
 MemStats;
+
+typedef struct
+{
+    // Accesses performed by the CPU (data reads, instruction fetches, writes)
+    i64 cpuReads;
+    i64 cpuWrites;
+    i64 cpuFetches;
+
+    // Accesses performed by Agnus (DMA)
+    i64 agnusReads;
+    i64 agnusWrites;
+
+    // DMA cycles the CPU was blocked because Agnus owned the bus
+    i64 waitCycles;
+}
+MemPageProfile;
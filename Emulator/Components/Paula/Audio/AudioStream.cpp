@@ -165,14 +165,14 @@ AudioStream::copyInterleaved(float *buffer, isize n)
 void 
 AudioStream::drawL(u32 *buffer, isize width, isize height, u32 color) const
 {
-    static float highest = 0.01f;
+    static thread_local float highest = 0.01f;
     highest = drawL(buffer, width, height, highest, color);
 }
 
 void
 AudioStream::drawR(u32 *buffer, isize width, isize height, u32 color) const
 {
-    static float highest = 0.01f;
+    static thread_local float highest = 0.01f;
     highest = drawR(buffer, width, height, highest, color);
 }
 
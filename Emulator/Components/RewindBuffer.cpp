@@ -0,0 +1,177 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "RewindBuffer.h"
+#include "Amiga.h"
+#include "Compression.h"
+#include <algorithm>
+
+namespace vamiga {
+
+void
+RewindBuffer::clear()
+{
+    entries.clear();
+    keyframe.dealloc();
+    state.dealloc();
+    packed.dealloc();
+    keysize = 0;
+    deltas = 0;
+    used = 0;
+}
+
+void
+RewindBuffer::record(isize budget)
+{
+    // Serialize the current state
+    serialize(state);
+
+    /* Record a keyframe if too many deltas have been recorded or if the
+     * layout of the state has changed, e.g., due to a memory reconfiguration.
+     */
+    bool key = deltas >= maxDeltas || state.size != keyframe.size;
+
+    if (key) {
+
+        keyframe.init(state);
+        deltas = 0;
+
+    } else {
+
+        // Compute the difference to the keyframe
+        for (isize i = 0; i < state.size; i++) state.ptr[i] ^= keyframe.ptr[i];
+        deltas++;
+    }
+
+    // Compress the state
+    auto bound = util::lzBound(state.size);
+    if (packed.size < bound) packed.alloc(bound);
+    auto size = util::lzCompress(state.ptr, state.size, packed.ptr);
+
+    // Start a new keyframe if the delta doesn't pay off any more
+    if (!key && size > keysize / 2) deltas = maxDeltas;
+    if (key) keysize = size;
+
+    entries.push_back(Entry {
+
+        .frame = amiga.agnus.pos.frame,
+        .keyframe = key,
+        .size = state.size,
+        .data = std::vector<u8>(packed.ptr, packed.ptr + size)
+    });
+    used += size;
+
+    debug(SNP_DEBUG, "Recorded %s in frame %lld (%ld bytes)\n",
+          key ? "keyframe" : "delta", amiga.agnus.pos.frame, size);
+
+    // Delete the oldest states if the budget is exceeded
+    trim(budget);
+}
+
+i64
+RewindBuffer::restore(i64 frame)
+{
+    if (!covers(frame)) throw Error(ERROR_SNAP_NO_REWIND_POINT);
+
+    // Find the newest state recorded prior to the requested frame
+    isize i = count() - 1;
+    while (entries[i].frame >= frame) i--;
+
+    // Find the keyframe this state depends on
+    isize k = i;
+    while (!entries[k].keyframe) k--;
+
+    try {
+
+        decompress(entries[k], keyframe);
+
+        if (i == k) {
+
+            deserialize(keyframe);
+
+        } else {
+
+            // Reconstruct the state by applying the delta to the keyframe
+            decompress(entries[i], state);
+            if (state.size != keyframe.size) throw Error(ERROR_SNAP_CORRUPTED);
+            for (isize j = 0; j < state.size; j++) state.ptr[j] ^= keyframe.ptr[j];
+
+            deserialize(state);
+        }
+
+    } catch (Error &error) {
+
+        clear();
+        throw error;
+    }
+
+    // Discard all states that have been recorded later
+    for (isize j = i + 1; j < count(); j++) used -= isize(entries[j].data.size());
+    entries.erase(entries.begin() + i + 1, entries.end());
+    keysize = isize(entries[k].data.size());
+    deltas = i - k;
+
+    return entries[i].frame;
+}
+
+void
+RewindBuffer::serialize(util::Buffer<u8> &buffer)
+{
+    // Determine the size of the emulator state
+    SerCounter counter;
+    amiga.postorderWalk([&](CoreComponent *c) { *c << counter; });
+    if (buffer.size != counter.count) buffer.alloc(counter.count);
+
+    // Serialize all components in the order they get restored
+    SerWriter writer(buffer.ptr);
+    amiga.postorderWalk([&](CoreComponent *c) { *c << writer; });
+    assert(writer.ptr == buffer.ptr + buffer.size);
+
+    amiga.postorderWalk([](CoreComponent *c) { c->_didSave(); });
+}
+
+void
+RewindBuffer::deserialize(const util::Buffer<u8> &buffer)
+{
+    SerReader reader(buffer.ptr);
+    amiga.postorderWalk([&](CoreComponent *c) { *c << reader; });
+    if (reader.ptr != buffer.ptr + buffer.size) throw Error(ERROR_SNAP_CORRUPTED);
+
+    amiga.postorderWalk([](CoreComponent *c) { c->_didLoad(); });
+}
+
+void
+RewindBuffer::decompress(const Entry &entry, util::Buffer<u8> &buffer)
+{
+    if (buffer.size != entry.size) buffer.alloc(entry.size);
+
+    auto size = util::lzDecompress(entry.data.data(), isize(entry.data.size()),
+                                   buffer.ptr, buffer.size);
+    if (size != entry.size) throw Error(ERROR_SNAP_CORRUPTED);
+}
+
+void
+RewindBuffer::trim(isize budget)
+{
+    while (memoryUsage() > budget) {
+
+        // Locate the next keyframe (the first entry is always a keyframe)
+        auto next = std::find_if(entries.begin() + 1, entries.end(),
+                                 [](const Entry &e) { return e.keyframe; });
+
+        // Never delete the most recent keyframe
+        if (next == entries.end()) break;
+
+        for (auto it = entries.begin(); it != next; it++) used -= isize(it->data.size());
+        entries.erase(entries.begin(), next);
+    }
+}
+
+}
@@ -0,0 +1,145 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "CoreObject.h"
+#include "Buffer.h"
+#include "Exception.h"
+#include <deque>
+#include <vector>
+
+namespace vamiga {
+
+class Amiga;
+
+/* The rewind buffer records the state of the emulator at regular intervals.
+ * Each recorded state is either a keyframe or a delta. A keyframe contains
+ * the complete serialized state. A delta contains the XOR difference between
+ * the recorded state and the preceding keyframe. Since only a small portion
+ * of the emulator state changes between two recordings, the XOR pass leaves
+ * long runs of zeroes which the LZ compressor squeezes to almost nothing.
+ * When the buffer exceeds its memory budget, the oldest keyframe is removed
+ * together with all deltas depending on it.
+ */
+class RewindBuffer final : public CoreObject {
+
+    // Maximum number of deltas following a keyframe
+    static constexpr isize maxDeltas = 15;
+
+    struct Entry {
+
+        // The frame in which the state has been recorded
+        i64 frame;
+
+        // Indicates if this entry is a keyframe or a delta
+        bool keyframe;
+
+        // Size of the uncompressed state
+        isize size;
+
+        // Compressed state (keyframes) or state difference (deltas)
+        std::vector<u8> data;
+    };
+
+    // The recorded emulator
+    Amiga &amiga;
+
+    // Recorded states (oldest first)
+    std::deque<Entry> entries;
+
+    // Uncompressed copy of the most recent keyframe
+    util::Buffer<u8> keyframe;
+
+    // Compressed size of the most recent keyframe
+    isize keysize = 0;
+
+    // Number of deltas recorded since the most recent keyframe
+    isize deltas = 0;
+
+    // Memory occupied by all entries in bytes
+    isize used = 0;
+
+    // Scratch buffers
+    util::Buffer<u8> state;
+    util::Buffer<u8> packed;
+
+
+    //
+    // Initializing
+    //
+
+public:
+
+    RewindBuffer(Amiga &ref) : amiga(ref) { }
+
+    // Deletes all recorded states
+    void clear();
+
+
+    //
+    // Methods from CoreObject
+    //
+
+public:
+
+    const char *objectName() const override { return "RewindBuffer"; }
+
+
+    //
+    // Analyzing
+    //
+
+public:
+
+    // Returns the number of recorded states
+    isize count() const { return isize(entries.size()); }
+
+    // Returns the number of bytes occupied by the buffer
+    isize memoryUsage() const { return used + keyframe.size; }
+
+    // Returns the frame numbers of the oldest and the newest recorded state
+    i64 oldestFrame() const { return entries.empty() ? -1 : entries.front().frame; }
+    i64 newestFrame() const { return entries.empty() ? -1 : entries.back().frame; }
+
+    // Checks if a state has been recorded prior to the specified frame
+    bool covers(i64 frame) const { return !entries.empty() && oldestFrame() < frame; }
+
+
+    //
+    // Recording and restoring
+    //
+
+public:
+
+    // Records the current emulator state
+    void record(isize budget);
+
+    /* Restores the newest state that has been recorded prior to the specified
+     * frame and returns the frame number of that state. All states recorded
+     * later are discarded.
+     */
+    i64 restore(i64 frame) throws;
+
+private:
+
+    // Serializes the emulator state into a buffer
+    void serialize(util::Buffer<u8> &buffer);
+
+    // Restores the emulator state from a buffer
+    void deserialize(const util::Buffer<u8> &buffer) throws;
+
+    // Decompresses an entry
+    void decompress(const Entry &entry, util::Buffer<u8> &buffer) throws;
+
+    // Deletes the oldest states until the buffer fits into the budget
+    void trim(isize budget);
+};
+
+}
@@ -41,7 +41,16 @@ class DiagBoard : public ZorroBoard {
 public:
     
     using ZorroBoard::ZorroBoard;
-    DiagBoard& operator= (const DiagBoard& other) { return *this; }
+
+    DiagBoard& operator= (const DiagBoard& other) {
+
+        CLONE(baseAddr)
+        CLONE(state)
+
+        CLONE(config)
+
+        return *this;
+    }
 
 
     //
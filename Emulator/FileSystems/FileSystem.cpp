@@ -836,7 +836,7 @@ FileSystem::getDisplayType(isize column)
     
     assert(column >= 0 && column < width);
     
-    static FSBlockType cache[width] = { };
+    static thread_local FSBlockType cache[width] = { };
 
     // Cache values when the type of the first column is requested
     if (column == 0) {
@@ -885,7 +885,7 @@ FileSystem::diagnoseImageSlice(isize column)
     
     assert(column >= 0 && column < width);
     
-    static i8 cache[width] = { };
+    static thread_local i8 cache[width] = { };
 
     // Cache values when the type of the first column is requested
     if (column == 0) {
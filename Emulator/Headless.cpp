@@ -12,11 +12,37 @@
 #include "Script.h"
 #include <filesystem>
 #include <chrono>
+#include <atomic>
+#include <sstream>
+#include <iomanip>
+#include <fstream>
 
 #ifndef _WIN32
 #include <getopt.h>
 #endif
 
+//
+// Heap allocation counters (reported by the benchmark suite)
+//
+
+static std::atomic<i64> allocations = 0;
+static std::atomic<i64> allocatedBytes = 0;
+
+void *operator new(std::size_t size)
+{
+    allocations++;
+    allocatedBytes += size;
+
+    if (auto ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete[](void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void *ptr, std::size_t) noexcept { std::free(ptr); }
+
 int main(int argc, char *argv[])
 {
     try {
@@ -25,10 +51,18 @@ int main(int argc, char *argv[])
         
     } catch (vamiga::SyntaxError &e) {
         
-        std::cout << "Usage: vAmigaCore [-csvm] | { [-vm] <script> } " << std::endl;
+        std::cout << "Usage: vAmigaCore [-cskvm] | { [-vm] <script> } | { -b [-f <n>] [-j <file>] [<rom> [<ext>]] }" << std::endl;
+        std::cout << "                  | { -B [-n] [-t <n>] [-f <n>] [-j <file>] <script> [<script> ...] }" << std::endl;
         std::cout << std::endl;
         std::cout << "       -c or --check     Checks the integrity of the build" << std::endl;
         std::cout << "       -s or --size      Reports the size of certain objects" << std::endl;
+        std::cout << "       -b or --bench     Runs the benchmark suite" << std::endl;
+        std::cout << "       -B or --batch     Runs each script in a separate emulator instance" << std::endl;
+        std::cout << "       -k or --kernels   Verifies the optimized rendering kernels" << std::endl;
+        std::cout << "       -t or --threads   Number of worker threads in batch mode" << std::endl;
+        std::cout << "       -n or --no-video  Runs the batch jobs without rendering any frames" << std::endl;
+        std::cout << "       -f or --frames    Number of frames per benchmark run or batch job" << std::endl;
+        std::cout << "       -j or --json      Writes the benchmark or batch results to a JSON file" << std::endl;
         std::cout << "       -v or --verbose   Print executed script lines" << std::endl;
         std::cout << "       -m or --messages  Observe the message queue" << std::endl;
         std::cout << std::endl;
@@ -76,6 +110,18 @@ Headless::main(int argc, char *argv[])
         reportSize();
         return 0;
 
+    } else if (keys.find("bench") != keys.end()) {
+
+        return runBenchmark();
+
+    } else if (keys.find("batch") != keys.end()) {
+
+        return runBatch();
+
+    } else if (keys.find("kernels") != keys.end()) {
+
+        return verifyKernels();
+
     } else {
 
         return execScript();
@@ -102,6 +148,13 @@ Headless::parseArguments(int argc, char *argv[])
         
         { "check",      no_argument,    NULL,   'c' },
         { "size",       no_argument,    NULL,   's' },
+        { "bench",      no_argument,    NULL,   'b' },
+        { "batch",      no_argument,    NULL,   'B' },
+        { "kernels",    no_argument,    NULL,   'k' },
+        { "threads",    required_argument, NULL, 't' },
+        { "no-video",   no_argument,    NULL,   'n' },
+        { "frames",     required_argument, NULL, 'f' },
+        { "json",       required_argument, NULL, 'j' },
         { "verbose",    no_argument,    NULL,   'v' },
         { "messages",   no_argument,    NULL,   'm' },
         { NULL,         0,              NULL,    0  }
@@ -116,7 +169,7 @@ Headless::parseArguments(int argc, char *argv[])
     // Parse all options
     while (1) {
         
-        int arg = getopt_long(argc, argv, ":csvm", long_options, NULL);
+        int arg = getopt_long(argc, argv, ":csbBkt:nf:j:vm", long_options, NULL);
         if (arg == -1) break;
 
         switch (arg) {
@@ -129,6 +182,34 @@ Headless::parseArguments(int argc, char *argv[])
                 keys["size"] = "1";
                 break;
 
+            case 'b':
+                keys["bench"] = "1";
+                break;
+
+            case 'B':
+                keys["batch"] = "1";
+                break;
+
+            case 'k':
+                keys["kernels"] = "1";
+                break;
+
+            case 't':
+                keys["threads"] = optarg;
+                break;
+
+            case 'n':
+                keys["novideo"] = "1";
+                break;
+
+            case 'f':
+                keys["frames"] = optarg;
+                break;
+
+            case 'j':
+                keys["json"] = optarg;
+                break;
+
             case 'v':
                 keys["verbose"] = "1";
                 break;
@@ -167,13 +248,59 @@ Headless::parseArguments(int argc, char *argv[])
 void
 Headless::checkArguments()
 {
-    if (keys.find("check") != keys.end() || keys.find("size") != keys.end()) {
+    if (keys.find("check") != keys.end() ||
+        keys.find("size") != keys.end() ||
+        keys.find("kernels") != keys.end()) {
 
         // No input file must be given
         if (keys.find("arg1") != keys.end()) {
             throw SyntaxError("No script file must be given");
         }
 
+    } else if (keys.find("bench") != keys.end()) {
+
+        // An optional Kickstart and an optional extension Rom can be given
+        if (keys.find("arg3") != keys.end()) {
+            throw SyntaxError("More than two Rom files are given");
+        }
+        for (auto &arg : { "arg1", "arg2" }) {
+
+            if (keys.find(arg) != keys.end() && !util::fileExists(keys[arg])) {
+                throw SyntaxError("File " + keys[arg] + " does not exist");
+            }
+        }
+
+        // The number of frames must be a positive number
+        if (keys.find("frames") != keys.end()) {
+
+            isize frames = 0;
+            try { frames = std::stol(keys["frames"]); } catch (...) { }
+            if (frames <= 0) throw SyntaxError("Invalid number of frames: " + keys["frames"]);
+        }
+
+    } else if (keys.find("batch") != keys.end()) {
+
+        // The user needs to specify at least one script file
+        if (keys.find("arg1") == keys.end()) {
+            throw SyntaxError("No script file is given");
+        }
+        for (isize nr = 1; keys.find("arg" + std::to_string(nr)) != keys.end(); nr++) {
+
+            auto &arg = keys["arg" + std::to_string(nr)];
+            if (!util::fileExists(arg)) throw SyntaxError("File " + arg + " does not exist");
+        }
+
+        // The frame budget and the number of threads must be positive numbers
+        for (auto &key : { "frames", "threads" }) {
+
+            if (keys.find(key) != keys.end()) {
+
+                isize value = 0;
+                try { value = std::stol(keys[key]); } catch (...) { }
+                if (value <= 0) throw SyntaxError("Invalid number of " + string(key) + ": " + keys[key]);
+            }
+        }
+
     } else {
 
         // The user needs to specify a single input file
@@ -293,4 +420,680 @@ Headless::execScript()
     return *returnCode;
 }
 
+int
+Headless::runBenchmark()
+{
+    std::stringstream json;
+
+    // Create an emulator instance
+    VAmiga vamiga;
+
+    // Launch the emulator thread
+    vamiga.launch(this, vamiga::process);
+    vamiga.set(OPT_AMIGA_WARP_MODE, WARP_ALWAYS);
+
+    json << "{\n";
+    json << "  \"version\": \"" << VAmiga::version() << "\",\n";
+    runThroughputBenchmark(vamiga, json);
+    json << ",\n";
+    runRunAheadBenchmark(vamiga, json);
+    json << ",\n";
+    runSnapshotBenchmark(vamiga, json);
+    json << ",\n";
+    runPlanarBenchmark(json);
+    json << "\n}\n";
+
+    vamiga.powerOff();
+    vamiga.halt();
+
+    // Write the results
+    writeJson(json.str());
+
+    return 0;
+}
+
+int
+Headless::runBatch()
+{
+    auto frames = keys.find("frames") != keys.end() ? std::stol(keys["frames"]) : 0;
+    auto threads = keys.find("threads") != keys.end() ? std::stol(keys["threads"]) : 0;
+    auto noVideo = keys.find("novideo") != keys.end();
+
+    // Create a job for each script
+    std::vector<BatchJob> jobs;
+    for (isize nr = 1; keys.find("arg" + std::to_string(nr)) != keys.end(); nr++) {
+
+        auto &path = keys["arg" + std::to_string(nr)];
+        std::ifstream file(path);
+        std::stringstream ss;
+        ss << file.rdbuf();
+
+        jobs.push_back(BatchJob {
+
+            .name = path,
+            .script = ss.str(),
+            .maxFrames = frames,
+            .noVideo = noVideo
+        });
+    }
+
+    // Run all jobs
+    auto results = VAmiga::runBatch(jobs, threads);
+
+    auto escape = [](const string &s) {
+
+        string result;
+        for (auto c : s) {
+
+            if (c == '"' || c == '\\') result += '\\';
+            result += c == '\n' ? ' ' : c;
+        }
+        return result;
+    };
+
+    // Report the results
+    std::stringstream json;
+    isize failed = 0;
+
+    json << "{\n";
+    json << "  \"version\": \"" << VAmiga::version() << "\",\n";
+    json << "  \"jobs\": [";
+
+    for (usize i = 0; i < results.size(); i++) {
+
+        auto &r = results[i];
+        auto fail = r.exit == BATCH_EXIT_ERROR || (r.exit == BATCH_EXIT_TESTER && r.retValue);
+        if (fail) failed++;
+
+        std::cout << (fail ? "FAIL " : "OK   ");
+        std::cout << std::left << std::setw(8) << BatchExitEnum::key(r.exit);
+        std::cout << std::right << std::setw(8) << r.frames << " frames ";
+        std::cout << std::fixed << std::setprecision(2) << std::setw(8) << r.seconds << " sec  ";
+        std::cout << r.name;
+        if (!r.message.empty()) std::cout << " (" << r.message << ")";
+        std::cout << std::endl;
+
+        json << (i ? ",\n" : "\n");
+        json << "    { \"name\": \"" << escape(r.name) << "\"";
+        json << ", \"exit\": \"" << BatchExitEnum::key(r.exit) << "\"";
+        json << ", \"retValue\": " << r.retValue;
+        json << ", \"frames\": " << r.frames;
+        json << ", \"cycles\": " << r.cycles;
+        json << ", \"seconds\": " << r.seconds;
+        json << ", \"message\": \"" << escape(r.message) << "\" }";
+    }
+    json << "\n  ]\n}\n";
+
+    std::cout << std::endl << results.size() - failed << " of " << results.size();
+    std::cout << " jobs succeeded" << std::endl;
+
+    // Write the results
+    writeJson(json.str());
+
+    return failed ? 1 : 0;
+}
+
+int
+Headless::verifyKernels()
+{
+    // Number of frames per run
+    static constexpr isize frames = 50;
+
+    // Emulates a scene and returns a checksum over all computed frames
+    auto run = [&](const KernelScene &scene, bool scalar) {
+
+        // Assemble the workload
+        u16 code[256];
+        isize words = 0;
+
+        auto append = [&](const u16 *src, isize count) {
+
+            for (isize i = 0; i < count; i++) code[words++] = src[i];
+        };
+        auto patch = [&](u16 reg, u16 value) {
+
+            for (isize i = 0; i + 2 < words; i++) {
+                if (code[i] == 0x3D7C && code[i + 2] == reg) code[i + 1] = value;
+            }
+        };
+
+        append(benchDisplay, isizeof(benchDisplay) / 2 - 1);
+        patch(0x100, scene.bplcon0);
+        patch(0x102, 0x0035);
+        patch(0x104, scene.bplcon2);
+        patch(0x092, scene.ddfstrt);
+        patch(0x094, scene.ddfstop);
+
+        for (u16 i = 0; i < 32; i++) {
+
+            u16 move[] = { 0x3D7C, u16((i * 0x137 + 0x0F1) & 0xFFF), u16(0x180 + 2 * i) };
+            append(move, 3);
+        }
+        append(kernelNoise, isizeof(kernelNoise) / 2);
+
+        Buffer<u8> rom;
+        assembleBenchmarkRom(rom, code, words);
+
+        // Create an emulator instance that is driven by this thread
+        Emulator emulator;
+        emulator.attach();
+
+        auto &amiga = emulator.main;
+        emulator.set(CONFIG_A500_ECS_1MB);
+        emulator.set(OPT_DENISE_REVISION, DENISE_ECS);
+        amiga.mem.loadRom(rom.ptr, rom.size);
+        amiga.denise.scalarKernels = scalar;
+        emulator.run();
+
+        u64 checksum = util::fnvInit64();
+        for (isize i = 0; i < frames; i++) {
+
+            emulator.step();
+            checksum = util::fnvIt64(checksum, amiga.denise.pixelEngine.getStableBuffer().pixels.fnv64());
+        }
+        return checksum;
+    };
+
+    msg("Rendering kernel test (%ld frames per run)\n\n", frames);
+    msg("     Scene            Optimized               Scalar\n");
+
+    isize failed = 0;
+    for (auto &scene : kernelScenes) {
+
+        auto optimized = run(scene, false);
+        auto scalar = run(scene, true);
+        if (optimized != scalar) failed++;
+
+        msg("%10s   %016llx   %016llx   %s\n", scene.name,
+            (unsigned long long)optimized, (unsigned long long)scalar,
+            optimized == scalar ? "Identical" : "MISMATCH");
+    }
+    msg("\n");
+
+    return failed ? 1 : 0;
+}
+
+void
+Headless::writeJson(const string &json)
+{
+    if (keys.find("json") != keys.end()) {
+
+        if (keys["json"] == "-") {
+
+            std::cout << json;
+
+        } else {
+
+            std::ofstream file(keys["json"]);
+            file << json;
+            if (!file) throw Error(ERROR_FILE_CANT_WRITE, keys["json"]);
+        }
+    }
+}
+
+void
+Headless::runThroughputBenchmark(VAmiga &vamiga, std::ostream &json)
+{
+    // Number of frames to run before measuring
+    static constexpr isize warmup = 50;
+
+    // Number of measured frames per run
+    isize frames = keys.find("frames") != keys.end() ? std::stol(keys["frames"]) : 500;
+
+    struct Result {
+
+        double frames;
+        double fps;
+        double mhz;
+        double frameTime;
+        i64 allocations;
+        i64 allocatedBytes;
+        AgnusStats dma;
+    };
+
+    auto measure = [&](const BenchConfig &config, std::function<bool()> install) -> std::optional<Result> {
+
+        vamiga.powerOff();
+        vamiga.set(config.scheme);
+        vamiga.set(OPT_CPU_REVISION, config.cpu);
+        vamiga.set(OPT_MEM_CHIP_RAM, config.chipRam);
+        vamiga.set(OPT_MEM_SLOW_RAM, config.slowRam);
+        vamiga.set(OPT_MEM_FAST_RAM, config.fastRam);
+        if (!install()) return { };
+        vamiga.run();
+
+        // Give the emulator some time to settle
+        while (vamiga.amiga.getInfo().frame < warmup) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        vamiga.agnus.clearProfile();
+        auto info1 = vamiga.amiga.getInfo();
+        auto allocs1 = allocations.load();
+        auto bytes1 = allocatedBytes.load();
+        auto start = std::chrono::steady_clock::now();
+
+        while (vamiga.amiga.getInfo().frame < info1.frame + frames) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        auto info2 = vamiga.amiga.getInfo();
+        auto allocs2 = allocations.load();
+        auto bytes2 = allocatedBytes.load();
+        vamiga.pause();
+
+        auto measured = double(info2.frame - info1.frame);
+
+        return Result {
+
+            .frames = measured,
+            .fps = measured / elapsed,
+            .mhz = AS_CPU_CYCLES(info2.cpuClock - info1.cpuClock) / elapsed / 1000000.0,
+            .frameTime = 1000000.0 * elapsed / measured,
+            .allocations = allocs2 - allocs1,
+            .allocatedBytes = bytes2 - bytes1,
+            .dma = vamiga.agnus.getStats()
+        };
+    };
+
+    msg("Throughput benchmark (warp mode, %ld frames per run)\n\n", frames);
+    msg("    Configuration Workload        Frames       MHz  Frame time    Overhead  Allocs\n");
+
+    json << "  \"throughput\": {\n";
+    json << "    \"frames\": " << frames << ",\n";
+    json << "    \"runs\": [";
+
+    bool first = true;
+    for (auto &config : benchConfigs) {
+
+        double baseline = 0.0;
+
+        auto report = [&](const char *workload, const Result &r) {
+
+            // The idle workload serves as the baseline for all other workloads
+            if (baseline == 0.0) baseline = r.frameTime;
+
+            msg("%17s %-8s %8.1f fps %9.2f %8.1f us %8.1f us %7lld\n",
+                config.name, workload, r.fps, r.mhz, r.frameTime,
+                r.frameTime - baseline, (long long)r.allocations);
+
+            json << (first ? "\n" : ",\n") << "      {\n";
+            json << "        \"config\": \"" << config.name << "\",\n";
+            json << "        \"cpu\": \"" << CPURevisionEnum::key(config.cpu) << "\",\n";
+            json << "        \"chipRam\": " << config.chipRam << ",\n";
+            json << "        \"slowRam\": " << config.slowRam << ",\n";
+            json << "        \"fastRam\": " << config.fastRam << ",\n";
+            json << "        \"workload\": \"" << workload << "\",\n";
+            json << "        \"fps\": " << r.fps << ",\n";
+            json << "        \"mhz\": " << r.mhz << ",\n";
+            json << "        \"frameTime\": " << r.frameTime << ",\n";
+            json << "        \"breakdown\": {\n";
+            json << "          \"baseline\": " << baseline << ",\n";
+            json << "          \"workload\": " << r.frameTime - baseline << "\n";
+            json << "        },\n";
+            json << "        \"dma\": {\n";
+            json << "          \"copper\": " << r.dma.copperActivity << ",\n";
+            json << "          \"blitter\": " << r.dma.blitterActivity << ",\n";
+            json << "          \"disk\": " << r.dma.diskActivity << ",\n";
+            json << "          \"audio\": " << r.dma.audioActivity << ",\n";
+            json << "          \"sprite\": " << r.dma.spriteActivity << ",\n";
+            json << "          \"bitplane\": " << r.dma.bitplaneActivity << "\n";
+            json << "        },\n";
+
+            // Add the CPU cycles lost to bus contention in the last frame
+            json << "        \"stalls\": {\n";
+            json << "          \"copper\": " << r.dma.copperStalls << ",\n";
+            json << "          \"blitter\": " << r.dma.blitterStalls << ",\n";
+            json << "          \"disk\": " << r.dma.diskStalls << ",\n";
+            json << "          \"audio\": " << r.dma.audioStalls << ",\n";
+            json << "          \"sprite\": " << r.dma.spriteStalls << ",\n";
+            json << "          \"bitplane\": " << r.dma.bitplaneStalls << ",\n";
+            json << "          \"refresh\": " << r.dma.refreshStalls << ",\n";
+            json << "          \"blocked\": " << r.dma.blockedStalls << ",\n";
+            json << "          \"eclock\": " << r.dma.eClockStalls << "\n";
+            json << "        },\n";
+
+            // Add the time per frame spent in each event slot if profiling is enabled
+            if (PROFILE_EVENTS && r.dma.ticksPerSecond > 0) {
+
+                json << "        \"slots\": {";
+                for (isize i = 0, n = 0; i < SLOT_COUNT; i++) {
+
+                    auto &profile = r.dma.slotProfile[i];
+                    if (profile.count == 0) continue;
+
+                    auto time = 1000000.0 * profile.ticks / r.dma.ticksPerSecond / r.frames;
+                    json << (n++ ? ",\n" : "\n") << "          \"" << EventSlotEnum::key(i) << "\": " << time;
+                }
+                json << "\n        },\n";
+            }
+
+            json << "        \"allocations\": " << r.allocations << ",\n";
+            json << "        \"allocatedBytes\": " << r.allocatedBytes << "\n";
+            json << "      }";
+            first = false;
+        };
+
+        for (auto &workload : benchWorkloads) {
+
+            auto result = measure(config, [&]() {
+
+                installBenchmarkRom(vamiga, workload);
+
+                // The disk workload reads from a blank disk
+                vamiga.df0.ejectDisk();
+                if (string(workload.name) == "disk") {
+                    vamiga.df0.insertBlankDisk(FS_OFS, BB_NONE, "Benchmark");
+                }
+                return true;
+            });
+            report(workload.name, *result);
+        }
+
+        // Boot Aros if it is available
+        auto result = measure(config, [&]() {
+
+            vamiga.df0.ejectDisk();
+            return installAros(vamiga);
+        });
+        if (result) report("boot", *result);
+
+        msg("\n");
+    }
+
+    json << "\n    ]\n";
+    json << "  }";
+}
+
+void
+Headless::runRunAheadBenchmark(VAmiga &vamiga, std::ostream &json)
+{
+    // Number of frames to run before measuring
+    static constexpr isize warmup = 50;
+
+    // Measurement interval per run
+    static constexpr auto duration = std::chrono::seconds(2);
+
+    // Configure the emulator
+    vamiga.powerOff();
+    vamiga.set(CONFIG_A500_ECS_1MB);
+    vamiga.set(OPT_MEM_FAST_RAM, 2048);
+    vamiga.df0.ejectDisk();
+    installBenchmarkRom(vamiga);
+
+    auto measure = [&](isize runAhead, bool input) {
+
+        vamiga.powerOff();
+        vamiga.set(OPT_AMIGA_RUN_AHEAD, runAhead);
+        vamiga.run();
+
+        // Give the emulator some time to settle
+        while (vamiga.amiga.getInfo().frame < warmup) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        auto frame = vamiga.amiga.getInfo().frame;
+        auto start = std::chrono::steady_clock::now();
+        auto stop = start + duration;
+        auto last = frame;
+
+        while (std::chrono::steady_clock::now() < stop) {
+
+            // Feed in a mouse event per frame to force a run-ahead clone
+            if (auto current = vamiga.amiga.getInfo().frame; input && current != last) {
+
+                vamiga.controlPort1.mouse.setDxDy(1, 0);
+                last = current;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+
+        auto frames = vamiga.amiga.getInfo().frame - frame;
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        vamiga.pause();
+
+        return double(frames) / std::chrono::duration<double>(elapsed).count();
+    };
+
+    msg("Run-ahead benchmark (warp mode, %lld s per run)\n\n",
+        (long long)duration.count());
+    msg("    Frames       Idle      Input   Overhead\n");
+
+    json << "  \"runAhead\": [";
+
+    double base = 0.0;
+    for (isize runAhead : { 0, 1, 2, 4, 8 }) {
+
+        auto idle = measure(runAhead, false);
+        auto input = measure(runAhead, true);
+        if (runAhead == 0) base = input;
+        auto overhead = base > 0 ? 100.0 * (base - input) / base : 0.0;
+
+        msg("%10ld %6.1f fps %6.1f fps %9.1f%%\n", runAhead, idle, input, overhead);
+
+        json << (runAhead ? ",\n" : "\n");
+        json << "    { \"frames\": " << runAhead << ", \"idle\": " << idle;
+        json << ", \"input\": " << input << ", \"overhead\": " << overhead << " }";
+    }
+    msg("\n");
+
+    json << "\n  ]";
+    vamiga.set(OPT_AMIGA_RUN_AHEAD, 0);
+}
+
+void
+Headless::runSnapshotBenchmark(VAmiga &vamiga, std::ostream &json)
+{
+    // Number of frames to run before measuring
+    static constexpr isize warmup = 50;
+
+    // Measurement interval per run
+    static constexpr auto duration = std::chrono::seconds(2);
+
+    msg("Snapshot benchmark (%lld s per run)\n\n", (long long)duration.count());
+
+    vamiga.powerOff();
+    vamiga.run();
+
+    // Give the emulator some time to settle
+    while (vamiga.amiga.getInfo().frame < warmup) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    vamiga.pause();
+
+    isize saved = 0, loaded = 0, bytes = 0;
+    std::unique_ptr<MediaFile> snapshot;
+
+    // Measure the save throughput
+    auto start = std::chrono::steady_clock::now();
+    auto stop = start + duration;
+    for (; std::chrono::steady_clock::now() < stop; saved++) {
+
+        snapshot.reset(vamiga.amiga.takeSnapshot());
+        bytes = snapshot->getSize();
+    }
+    double saveTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Measure the load throughput
+    start = std::chrono::steady_clock::now();
+    stop = start + duration;
+    for (; std::chrono::steady_clock::now() < stop; loaded++) {
+
+        vamiga.amiga.loadSnapshot(*snapshot);
+    }
+    double loadTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    msg("      Save %8.1f/s %8.2f ms\n", saved / saveTime, 1000.0 * saveTime / saved);
+    msg("      Load %8.1f/s %8.2f ms\n", loaded / loadTime, 1000.0 * loadTime / loaded);
+    msg("      Size %10ld bytes\n", bytes);
+    msg("\n");
+
+    json << "  \"snapshot\": {\n";
+    json << "    \"save\": " << 1000.0 * saveTime / saved << ",\n";
+    json << "    \"load\": " << 1000.0 * loadTime / loaded << ",\n";
+    json << "    \"size\": " << bytes << "\n";
+    json << "  }";
+}
+
+void
+Headless::runPlanarBenchmark(std::ostream &json)
+{
+    // Number of bitplane words and measurement rounds
+    static constexpr isize count = 4096;
+    static constexpr isize rounds = 1000;
+
+    msg("Planar-to-chunky benchmark (%ld conversions per run)\n\n", count * rounds);
+
+    // Generate pseudo-random bitplane data
+    std::vector<u16> data(6 * count);
+    u32 seed = 0x12345678;
+    for (auto &word : data) { seed = seed * 1103515245 + 12345; word = u16(seed >> 16); }
+
+    // The original implementation extracting one bit at a time
+    auto reference = [](const u16 regs[6], u8 slices[16]) {
+
+        u16 mask = 0x8000;
+        for (isize i = 0; i < 16; i++, mask >>= 1) {
+
+            slices[i] = (u8) ((!!(regs[0] & mask) << 0) |
+                              (!!(regs[1] & mask) << 1) |
+                              (!!(regs[2] & mask) << 2) |
+                              (!!(regs[3] & mask) << 3) |
+                              (!!(regs[4] & mask) << 4) |
+                              (!!(regs[5] & mask) << 5) );
+        }
+    };
+
+    // The table-driven implementation used by Denise
+    auto table = [](const u16 regs[6], u8 slices[16]) {
+
+        Denise::planarToChunky<0b111111>(regs, slices);
+    };
+
+    // Returns the time per conversion in nanoseconds and a checksum
+    auto measure = [&](auto convert) {
+
+        u8 slices[16];
+        u64 checksum = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (isize r = 0; r < rounds; r++) {
+
+            for (isize i = 0; i < count; i++) {
+
+                convert(&data[6 * i], slices);
+
+                u64 left, right;
+                std::memcpy(&left, slices, 8);
+                std::memcpy(&right, slices + 8, 8);
+                checksum = (checksum << 1 | checksum >> 63) ^ left ^ right << 3;
+            }
+        }
+        auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        return std::pair<double, u64> { 1e9 * elapsed / (count * rounds), checksum };
+    };
+
+    auto [bitTime, bitSum] = measure(reference);
+    auto [tableTime, tableSum] = measure(table);
+
+    msg("   Bitwise %8.2f ns\n", bitTime);
+    msg("     Table %8.2f ns\n", tableTime);
+    msg("   Speedup %8.2fx\n", bitTime / tableTime);
+    msg(" Identical %8s\n", bitSum == tableSum ? "yes" : "NO");
+    msg("\n");
+
+    json << "  \"planar\": {\n";
+    json << "    \"bitwise\": " << bitTime << ",\n";
+    json << "    \"table\": " << tableTime << ",\n";
+    json << "    \"identical\": " << (bitSum == tableSum ? "true" : "false") << "\n";
+    json << "  }";
+}
+
+void
+Headless::installBenchmarkRom(VAmiga &vamiga)
+{
+    if (keys.find("arg1") != keys.end()) {
+
+        // Use the Roms provided on the command line
+        vamiga.mem.loadRom(keys["arg1"]);
+        if (keys.find("arg2") != keys.end()) vamiga.mem.loadExt(keys["arg2"]);
+
+    } else {
+
+        // Use the built-in benchmark Kickstart
+        installBenchmarkRom(vamiga, benchWorkloads[1]);
+    }
+}
+
+void
+Headless::installBenchmarkRom(VAmiga &vamiga, const BenchWorkload &workload)
+{
+    Buffer<u8> rom;
+    assembleBenchmarkRom(rom, workload.code, workload.words);
+
+    vamiga.mem.deleteExt();
+    vamiga.mem.loadRom(rom.ptr, rom.size);
+}
+
+void
+Headless::assembleBenchmarkRom(Buffer<u8> &rom, const u16 *code, isize words)
+{
+    rom.init(KB(256), 0);
+
+    auto poke = [&](isize &addr, const u16 *code, isize words) {
+
+        for (isize i = 0; i < words; i++, addr += 2) {
+
+            rom[addr] = HI_BYTE(code[i]);
+            rom[addr + 1] = LO_BYTE(code[i]);
+        }
+    };
+
+    // Header
+    const u8 header[] = { 0x11, 0x11, 0x4E, 0xF9, 0x00, 0xFC, 0x00, 0xD2 };
+    for (isize i = 0; i < isizeof(header); i++) rom[i] = header[i];
+
+    // Code
+    isize addr = 0xD2;
+    poke(addr, benchPrologue, isizeof(benchPrologue) / 2);
+    poke(addr, code, words);
+}
+
+bool
+Headless::installAros(VAmiga &vamiga)
+{
+    string rom, ext;
+
+    if (keys.find("arg1") != keys.end()) {
+
+        // Use the Roms provided on the command line
+        rom = keys["arg1"];
+        if (keys.find("arg2") != keys.end()) ext = keys["arg2"];
+
+    } else {
+
+#if defined(AROS_ROM) && defined(AROS_EXT)
+
+        // Use the Roms bundled with the application
+        rom = AROS_ROM;
+        ext = AROS_EXT;
+
+#endif
+    }
+
+    if (rom.empty() || !util::fileExists(rom)) return false;
+    if (!ext.empty() && !util::fileExists(ext)) return false;
+
+    vamiga.mem.deleteExt();
+    vamiga.mem.loadRom(rom);
+    if (!ext.empty()) {
+
+        vamiga.set(OPT_MEM_EXT_START, 0xE0);
+        vamiga.mem.loadExt(ext);
+    }
+    return true;
+}
+
 }
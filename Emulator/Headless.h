@@ -26,6 +26,8 @@ struct SyntaxError : public std::runtime_error {
 
 void process(const void *listener, Message msg);
 
+struct BenchWorkload;
+
 class Headless {
 
     // Parsed command line arguments
@@ -61,6 +63,24 @@ private:
     // Executes the provided script
     int execScript();
 
+    // Runs the benchmark suite
+    int runBenchmark();
+
+    // Runs all scripts as a batch of independent emulator instances
+    int runBatch();
+
+    // Compares the optimized rendering kernels with the scalar versions
+    int verifyKernels();
+
+    // Writes JSON formatted results to the file given by the --json option
+    void writeJson(const string &json);
+
+    // Runs the different parts of the benchmark suite
+    void runThroughputBenchmark(VAmiga &vamiga, std::ostream &json);
+    void runRunAheadBenchmark(VAmiga &vamiga, std::ostream &json);
+    void runSnapshotBenchmark(VAmiga &vamiga, std::ostream &json);
+    void runPlanarBenchmark(std::ostream &json);
+
     
     //
     // Running
@@ -73,6 +93,275 @@ public:
 
     // Processes an incoming message
     void process(Message msg);
+
+private:
+
+    // Installs the Kickstart used by the benchmark suite
+    void installBenchmarkRom(VAmiga &vamiga);
+    void installBenchmarkRom(VAmiga &vamiga, const BenchWorkload &workload);
+
+    // Assembles a benchmark Kickstart running the provided workload
+    void assembleBenchmarkRom(Buffer<u8> &rom, const u16 *code, isize words);
+
+    // Installs the Aros Kickstart (returns false if no Aros Rom is available)
+    bool installAros(VAmiga &vamiga);
+};
+
+//
+// Benchmark Kickstart
+//
+
+/* A minimalistic Kickstart replacement used by the benchmark suite. The Rom
+ * consists of a common prologue and a workload. The prologue switches off the
+ * memory overlay, disables all interrupts and DMA channels, and loads the
+ * custom chip base address into a6. The workload stresses a particular
+ * component and runs forever. The code is placed at the usual entry point
+ * $FC00D2.
+ */
+static const u16 benchPrologue[] = {
+
+    0x46FC, 0x2700,                         // move.w  #$2700,sr
+    0x2E7C, 0x0008, 0x0000,                 // movea.l #$80000,a7
+    0x13FC, 0x0003, 0x00BF, 0xE201,         // move.b  #$03,$BFE201
+    0x13FC, 0x0002, 0x00BF, 0xE001,         // move.b  #$02,$BFE001
+    0x4DF9, 0x00DF, 0xF000,                 // lea     $DFF000,a6
+    0x3D7C, 0x7FFF, 0x009A,                 // move.w  #$7FFF,INTENA(a6)
+    0x3D7C, 0x7FFF, 0x0096,                 // move.w  #$7FFF,DMACON(a6)
+    0x3D7C, 0x7FFF, 0x009C                  // move.w  #$7FFF,INTREQ(a6)
+};
+
+// Idles in a tight loop (serves as a baseline)
+static const u16 benchIdle[] = {
+
+    0x60FE                                  // idle:   bra idle
+};
+
+// Continuously writes to a 64 KB chunk of Chip Ram
+static const u16 benchCpu[] = {
+
+    0x41F9, 0x0000, 0x1000,                 // loop:   lea $1000,a0
+    0x303C, 0x3FFF,                         //         move.w #$3FFF,d0
+    0x20C1,                                 // inner:  move.l d1,(a0)+
+    0x5281,                                 //         addq.l #1,d1
+    0x51C8, 0xFFFA,                         //         dbra d0,inner
+    0x60EC                                  //         bra loop
+};
+
+// Runs a Copper list with 16384 consecutive writes to COLOR00
+static const u16 benchCopper[] = {
+
+    0x41F9, 0x0001, 0x0000,                 //         lea $10000,a0
+    0x303C, 0x3FFF,                         //         move.w #$3FFF,d0
+    0x7200,                                 //         moveq #0,d1
+    0x30FC, 0x0180,                         // build:  move.w #$0180,(a0)+
+    0x30C1,                                 //         move.w d1,(a0)+
+    0x5241,                                 //         addq.w #1,d1
+    0x51C8, 0xFFF6,                         //         dbra d0,build
+    0x20BC, 0xFFFF, 0xFFFE,                 //         move.l #$FFFFFFFE,(a0)
+    0x2D7C, 0x0001, 0x0000, 0x0080,         //         move.l #$10000,COP1LC(a6)
+    0x3D40, 0x0088,                         //         move.w d0,COPJMP1(a6)
+    0x3D7C, 0x8280, 0x0096,                 //         move.w #$8280,DMACON(a6)
+    0x60FE                                  // idle:   bra idle
+};
+
+// Performs back-to-back ABCD blits over 64 KB of Chip Ram
+static const u16 benchBlitter[] = {
+
+    0x3D7C, 0x8240, 0x0096,                 //         move.w #$8240,DMACON(a6)
+    0x3D7C, 0x0FCA, 0x0040,                 //         move.w #$0FCA,BLTCON0(a6)
+    0x3D7C, 0x0000, 0x0042,                 //         move.w #$0000,BLTCON1(a6)
+    0x2D7C, 0xFFFF, 0xFFFF, 0x0044,         //         move.l #$FFFFFFFF,BLTAFWM(a6)
+    0x2D7C, 0x0000, 0x0000, 0x0060,         //         move.l #0,BLTCMOD(a6)
+    0x2D7C, 0x0000, 0x0000, 0x0064,         //         move.l #0,BLTAMOD(a6)
+    0x2D7C, 0x0002, 0x0000, 0x0050,         // blit:   move.l #$20000,BLTAPT(a6)
+    0x2D7C, 0x0003, 0x0000, 0x004C,         //         move.l #$30000,BLTBPT(a6)
+    0x2D7C, 0x0004, 0x0000, 0x0048,         //         move.l #$40000,BLTCPT(a6)
+    0x2D7C, 0x0004, 0x0000, 0x0054,         //         move.l #$40000,BLTDPT(a6)
+    0x3D7C, 0x8000, 0x0058,                 //         move.w #$8000,BLTSIZE(a6)
+    0x4A6E, 0x0002,                         //         tst.w DMACONR(a6)
+    0x082E, 0x0006, 0x0002,                 // wait:   btst #6,DMACONR(a6)
+    0x66F8,                                 //         bne wait
+    0x60CC                                  //         bra blit
+};
+
+// Displays a 320 x 256 screen with six bitplanes
+static const u16 benchDisplay[] = {
+
+    0x41F9, 0x0002, 0x0000,                 //         lea $20000,a0
+    0x303C, 0x3BFF,                         //         move.w #$3BFF,d0
+    0x223C, 0x1234, 0x5678,                 //         move.l #$12345678,d1
+    0x20C1,                                 // fill:   move.l d1,(a0)+
+    0xEB99,                                 //         rol.l #5,d1
+    0x5E81,                                 //         addq.l #7,d1
+    0x51C8, 0xFFF8,                         //         dbra d0,fill
+    0x41F9, 0x0001, 0x0000,                 //         lea $10000,a0
+    0x20FC, 0x00E0, 0x0002,                 //         move.l #$00E00002,(a0)+
+    0x20FC, 0x00E2, 0x0000,                 //         move.l #$00E20000,(a0)+
+    0x20FC, 0x00E4, 0x0002,                 //         move.l #$00E40002,(a0)+
+    0x20FC, 0x00E6, 0x2800,                 //         move.l #$00E62800,(a0)+
+    0x20FC, 0x00E8, 0x0002,                 //         move.l #$00E80002,(a0)+
+    0x20FC, 0x00EA, 0x5000,                 //         move.l #$00EA5000,(a0)+
+    0x20FC, 0x00EC, 0x0002,                 //         move.l #$00EC0002,(a0)+
+    0x20FC, 0x00EE, 0x7800,                 //         move.l #$00EE7800,(a0)+
+    0x20FC, 0x00F0, 0x0002,                 //         move.l #$00F00002,(a0)+
+    0x20FC, 0x00F2, 0xA000,                 //         move.l #$00F2A000,(a0)+
+    0x20FC, 0x00F4, 0x0002,                 //         move.l #$00F40002,(a0)+
+    0x20FC, 0x00F6, 0xC800,                 //         move.l #$00F6C800,(a0)+
+    0x20FC, 0xFFFF, 0xFFFE,                 //         move.l #$FFFFFFFE,(a0)+
+    0x2D7C, 0x0001, 0x0000, 0x0080,         //         move.l #$10000,COP1LC(a6)
+    0x3D7C, 0x6200, 0x0100,                 //         move.w #$6200,BPLCON0(a6)
+    0x3D7C, 0x0000, 0x0102,                 //         move.w #$0000,BPLCON1(a6)
+    0x3D7C, 0x0000, 0x0104,                 //         move.w #$0000,BPLCON2(a6)
+    0x3D7C, 0x2C81, 0x008E,                 //         move.w #$2C81,DIWSTRT(a6)
+    0x3D7C, 0x2CC1, 0x0090,                 //         move.w #$2CC1,DIWSTOP(a6)
+    0x3D7C, 0x0038, 0x0092,                 //         move.w #$0038,DDFSTRT(a6)
+    0x3D7C, 0x00D0, 0x0094,                 //         move.w #$00D0,DDFSTOP(a6)
+    0x2D7C, 0x0000, 0x0000, 0x0108,         //         move.l #0,BPL1MOD(a6)
+    0x3D7C, 0x8380, 0x0096,                 //         move.w #$8380,DMACON(a6)
+    0x60FE                                  // idle:   bra idle
+};
+
+// Continuously reads a track from the disk in df0
+static const u16 benchDisk[] = {
+
+    0x13FC, 0x00FF, 0x00BF, 0xD300,         //         move.b #$FF,$BFD300
+    0x13FC, 0x007F, 0x00BF, 0xD100,         //         move.b #$7F,$BFD100
+    0x13FC, 0x0077, 0x00BF, 0xD100,         //         move.b #$77,$BFD100
+    0x3D7C, 0x7F00, 0x009E,                 //         move.w #$7F00,ADKCON(a6)
+    0x3D7C, 0x9500, 0x009E,                 //         move.w #$9500,ADKCON(a6)
+    0x3D7C, 0x4489, 0x007E,                 //         move.w #$4489,DSKSYNC(a6)
+    0x3D7C, 0x8210, 0x0096,                 //         move.w #$8210,DMACON(a6)
+    0x3D7C, 0x4000, 0x0024,                 // read:   move.w #$4000,DSKLEN(a6)
+    0x2D7C, 0x0002, 0x0000, 0x0020,         //         move.l #$20000,DSKPT(a6)
+    0x3D7C, 0x0002, 0x009C,                 //         move.w #$0002,INTREQ(a6)
+    0x3D7C, 0x9900, 0x0024,                 //         move.w #$9900,DSKLEN(a6)
+    0x3D7C, 0x9900, 0x0024,                 //         move.w #$9900,DSKLEN(a6)
+    0x082E, 0x0001, 0x001F,                 // wait:   btst #1,INTREQR+1(a6)
+    0x67F8,                                 //         beq wait
+    0x60D6                                  //         bra read
+};
+
+// Plays a 64 KB sample on all four audio channels
+static const u16 benchAudio[] = {
+
+    0x41F9, 0x0002, 0x0000,                 //         lea $20000,a0
+    0x303C, 0x3FFF,                         //         move.w #$3FFF,d0
+    0x223C, 0x1234, 0x5678,                 //         move.l #$12345678,d1
+    0x20C1,                                 // fill:   move.l d1,(a0)+
+    0xEB99,                                 //         rol.l #5,d1
+    0x5E81,                                 //         addq.l #7,d1
+    0x51C8, 0xFFF8,                         //         dbra d0,fill
+    0x2D7C, 0x0002, 0x0000, 0x00A0,         //         move.l #$20000,AUD0LC(a6)
+    0x3D7C, 0x8000, 0x00A4,                 //         move.w #$8000,AUD0LEN(a6)
+    0x3D7C, 0x007C, 0x00A6,                 //         move.w #124,AUD0PER(a6)
+    0x3D7C, 0x0040, 0x00A8,                 //         move.w #64,AUD0VOL(a6)
+    0x2D7C, 0x0002, 0x0000, 0x00B0,         //         move.l #$20000,AUD1LC(a6)
+    0x3D7C, 0x8000, 0x00B4,                 //         move.w #$8000,AUD1LEN(a6)
+    0x3D7C, 0x007C, 0x00B6,                 //         move.w #124,AUD1PER(a6)
+    0x3D7C, 0x0040, 0x00B8,                 //         move.w #64,AUD1VOL(a6)
+    0x2D7C, 0x0002, 0x0000, 0x00C0,         //         move.l #$20000,AUD2LC(a6)
+    0x3D7C, 0x8000, 0x00C4,                 //         move.w #$8000,AUD2LEN(a6)
+    0x3D7C, 0x007C, 0x00C6,                 //         move.w #124,AUD2PER(a6)
+    0x3D7C, 0x0040, 0x00C8,                 //         move.w #64,AUD2VOL(a6)
+    0x2D7C, 0x0002, 0x0000, 0x00D0,         //         move.l #$20000,AUD3LC(a6)
+    0x3D7C, 0x8000, 0x00D4,                 //         move.w #$8000,AUD3LEN(a6)
+    0x3D7C, 0x007C, 0x00D6,                 //         move.w #124,AUD3PER(a6)
+    0x3D7C, 0x0040, 0x00D8,                 //         move.w #64,AUD3VOL(a6)
+    0x3D7C, 0x820F, 0x0096,                 //         move.w #$820F,DMACON(a6)
+    0x60FE                                  // idle:   bra idle
+};
+
+struct BenchWorkload {
+
+    const char *name;
+    const u16 *code;
+    isize words;
+};
+
+#define WORKLOAD(name, code) { name, code, isizeof(code) / 2 }
+
+static const BenchWorkload benchWorkloads[] = {
+
+    WORKLOAD("idle", benchIdle),
+    WORKLOAD("cpu", benchCpu),
+    WORKLOAD("copper", benchCopper),
+    WORKLOAD("blitter", benchBlitter),
+    WORKLOAD("display", benchDisplay),
+    WORKLOAD("disk", benchDisk),
+    WORKLOAD("audio", benchAudio)
+};
+
+#undef WORKLOAD
+
+struct BenchConfig {
+
+    const char *name;
+    ConfigScheme scheme;
+    CPURevision cpu;
+    isize chipRam;
+    isize slowRam;
+    isize fastRam;
+};
+
+static const BenchConfig benchConfigs[] = {
+
+    { "A500_OCS_68000", CONFIG_A500_OCS_1MB, CPU_68000, 512, 512, 0 },
+    { "A500_ECS_68000", CONFIG_A500_ECS_1MB, CPU_68000, 512, 512, 2048 },
+    { "A500_ECS_68020", CONFIG_A500_ECS_1MB, CPU_68EC020, 1024, 0, 8192 }
+};
+
+//
+// Rendering kernel test
+//
+
+/* The kernel test runs the display workload in various bitplane modes. Each
+ * scene is emulated twice, once with the optimized and once with the scalar
+ * rendering kernels. Both runs must produce the same frames. To achieve a
+ * good coverage, the workload is extended by a color table setup and the
+ * following routine which fills the bitplanes with pseudo-random data.
+ */
+static const u16 kernelNoise[] = {
+
+    0x41F9, 0x0002, 0x0000,                 //         lea $20000,a0
+    0x303C, 0x3BFF,                         //         move.w #$3BFF,d0
+    0x223C, 0x1234, 0x5678,                 //         move.l #$12345678,d1
+    0x2401,                                 // fill:   move.l d1,d2
+    0x760D,                                 //         moveq #13,d3
+    0xE7AA,                                 //         lsl.l d3,d2
+    0xB581,                                 //         eor.l d2,d1
+    0x2401,                                 //         move.l d1,d2
+    0x7611,                                 //         moveq #17,d3
+    0xE6AA,                                 //         lsr.l d3,d2
+    0xB581,                                 //         eor.l d2,d1
+    0x2401,                                 //         move.l d1,d2
+    0x7605,                                 //         moveq #5,d3
+    0xE7AA,                                 //         lsl.l d3,d2
+    0xB581,                                 //         eor.l d2,d1
+    0x20C1,                                 //         move.l d1,(a0)+
+    0x51C8, 0xFFE4,                         //         dbra d0,fill
+    0x60FE                                  // idle:   bra idle
+};
+
+struct KernelScene {
+
+    const char *name;
+    u16 bplcon0;
+    u16 bplcon2;
+    u16 ddfstrt;
+    u16 ddfstop;
+};
+
+static const KernelScene kernelScenes[] = {
+
+    { "lores",      0x6200, 0x0024, 0x0038, 0x00D0 },
+    { "invprio",    0x5200, 0x0028, 0x0038, 0x00D0 },
+    { "ham",        0x6A00, 0x0024, 0x0038, 0x00D0 },
+    { "dpf",        0x6600, 0x0024, 0x0038, 0x00D0 },
+    { "dpfpri",     0x6600, 0x0064, 0x0038, 0x00D0 },
+    { "dpfinv",     0x6600, 0x003F, 0x0038, 0x00D0 },
+    { "dpfinv2",    0x6600, 0x0007, 0x0038, 0x00D0 },
+    { "hiresdpf",   0xC600, 0x0049, 0x003C, 0x00D4 },
+    { "shres",      0x2240, 0x0024, 0x003C, 0x00D4 }
 };
 
 //
@@ -11,6 +11,7 @@
 #include "Snapshot.h"
 #include "Amiga.h"
 #include "IOUtils.h"
+#include "Compression.h"
 
 namespace vamiga {
 
@@ -71,10 +72,53 @@ Snapshot::Snapshot(isize capacity)
     header->beta = SNP_BETA;
 }
 
-Snapshot::Snapshot(Amiga &amiga) : Snapshot(amiga.size())
+Snapshot::Snapshot(Amiga &amiga) : Snapshot(0)
 {
+    // Collect all components in the order they are restored
+    std::vector<CoreComponent *> components;
+    amiga.postorderWalk([&](CoreComponent *c) { components.push_back(c); });
+    isize count = isize(components.size());
+
+    // Determine the maximum chunk size and the maximum snapshot size
+    isize maxSize = 0, capacity = count * isizeof(SnapshotChunk);
+    for (auto &c : components) {
+
+        auto size = c->size(false);
+        maxSize = std::max(maxSize, size);
+        capacity += util::lzBound(size);
+    }
+    data.resize(isizeof(SnapshotHeader) + capacity);
+
+    auto *chunks = (SnapshotChunk *)getData();
+    auto *ptr = getData() + count * isizeof(SnapshotChunk);
+    Buffer<u8> buffer(maxSize);
+
+    for (isize i = 0; i < count; i++) {
+
+        auto &chunk = chunks[i];
+        auto name = components[i]->objectName();
+
+        // Serialize the component and compress the result
+        chunk.id = util::fnv32((const u8 *)name, (isize)strlen(name));
+        chunk.rawSize = components[i]->saveState(buffer.ptr);
+        chunk.size = util::lzCompress(buffer.ptr, chunk.rawSize, ptr);
+        chunk.compressed = true;
+
+        // Store the data uncompressed if compression doesn't pay off
+        if (chunk.size >= chunk.rawSize) {
+
+            std::memcpy(ptr, buffer.ptr, chunk.rawSize);
+            chunk.size = chunk.rawSize;
+            chunk.compressed = false;
+        }
+        ptr += chunk.size;
+    }
+
+    ((SnapshotHeader *)data.ptr)->chunks = u32(count);
+    data.resize(isize(ptr - data.ptr));
+
     takeScreenshot(amiga);
-    amiga.save(getData());
+    amiga.postorderWalk([](CoreComponent *c) { c->_didSave(); });
 }
 
 void
@@ -145,4 +189,91 @@ Snapshot::takeScreenshot(Amiga &amiga)
     ((SnapshotHeader *)data.ptr)->screenshot.take(amiga);
 }
 
+void
+Snapshot::restore(Amiga &amiga) const
+{
+    auto *ptr = getData() + numChunks() * isizeof(SnapshotChunk);
+    auto *end = data.ptr + data.size;
+
+    restore(amiga, getChunks(), numChunks(), [&](isize size) -> const u8 * {
+
+        if (size > end - ptr) return nullptr;
+
+        auto result = ptr;
+        ptr += size;
+        return result;
+    });
+}
+
+void
+Snapshot::restore(Amiga &amiga, std::istream &stream)
+{
+    if (!isCompatible(stream)) throw Error(ERROR_FILE_TYPE_MISMATCH);
+
+    // Read the header and check the version number
+    Snapshot snapshot(0);
+    stream.seekg(0, std::ios::beg);
+    stream.read((char *)snapshot.data.ptr, isizeof(SnapshotHeader));
+    snapshot.finalizeRead();
+
+    // Read the table of contents
+    std::vector<SnapshotChunk> chunks(snapshot.numChunks());
+    stream.read((char *)chunks.data(), chunks.size() * sizeof(SnapshotChunk));
+    if (!stream) throw Error(ERROR_SNAP_CORRUPTED);
+
+    // Read the chunks one after another
+    Buffer<u8> buffer;
+    restore(amiga, chunks.data(), isize(chunks.size()), [&](isize size) -> const u8 * {
+
+        if (buffer.size < size) buffer.alloc(size);
+        stream.read((char *)buffer.ptr, size);
+        return stream ? buffer.ptr : nullptr;
+    });
+}
+
+void
+Snapshot::restore(Amiga &amiga, const SnapshotChunk *chunks, isize count,
+                  std::function<const u8 *(isize)> read)
+{
+    // Collect all components in the order they have been saved
+    std::vector<CoreComponent *> components;
+    amiga.postorderWalk([&](CoreComponent *c) { components.push_back(c); });
+    if (isize(components.size()) != count) throw Error(ERROR_SNAP_CORRUPTED);
+
+    Buffer<u8> buffer;
+
+    for (isize i = 0; i < count; i++) {
+
+        auto &chunk = chunks[i];
+        auto name = components[i]->objectName();
+
+        // Check if the chunk belongs to this component
+        if (chunk.id != util::fnv32((const u8 *)name, (isize)strlen(name))) {
+            throw Error(ERROR_SNAP_CORRUPTED);
+        }
+
+        // Fetch the chunk data
+        auto *state = read(isize(chunk.size));
+        if (!state) throw Error(ERROR_SNAP_CORRUPTED);
+
+        // Decompress the chunk data if needed
+        if (chunk.compressed) {
+
+            auto rawSize = isize(chunk.rawSize);
+            if (buffer.size < rawSize) buffer.alloc(rawSize);
+            if (util::lzDecompress(state, isize(chunk.size), buffer.ptr, rawSize) != rawSize) {
+                throw Error(ERROR_SNAP_CORRUPTED);
+            }
+            state = buffer.ptr;
+        }
+
+        // Restore the component state
+        if (components[i]->loadState(state) != isize(chunk.rawSize)) {
+            throw Error(ERROR_SNAP_CORRUPTED);
+        }
+    }
+
+    amiga.postorderWalk([](CoreComponent *c) { c->_didLoad(); });
+}
+
 }
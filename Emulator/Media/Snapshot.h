@@ -11,6 +11,7 @@
 
 #include "AmigaFile.h"
 #include "Constants.h"
+#include <functional>
 
 namespace vamiga {
 
@@ -41,12 +42,32 @@ struct SnapshotHeader {
     u8 beta;
 
     // Padding bytes
-    u8 reserved[6];
+    u8 reserved[2];
+
+    // Number of chunks
+    u32 chunks;
 
     // Preview image
     Thumbnail screenshot;
 };
 
+/* The header is followed by a table of contents and the chunk data. Each
+ * chunk stores the state of a single component. The chunks are arranged in
+ * the same order in which the components are traversed by postorderWalk().
+ */
+struct SnapshotChunk {
+
+    // Checksum of the component name
+    u32 id;
+
+    // Indicates if the chunk data is LZ compressed
+    u32 compressed;
+
+    // Size of the stored data and size of the uncompressed data
+    u64 size;
+    u64 rawSize;
+};
+
 class Snapshot : public AmigaFile {
 
 public:
@@ -102,8 +123,30 @@ public:
     // Returns pointer to the core data
     u8 *getData() const override { return data.ptr + sizeof(SnapshotHeader); }
 
+    // Returns a pointer to the table of contents
+    const SnapshotChunk *getChunks() const { return (SnapshotChunk *)getData(); }
+    isize numChunks() const { return isize(getHeader()->chunks); }
+
     // Takes a screenshot
     void takeScreenshot(Amiga &amiga);
+
+
+    //
+    // Restoring
+    //
+
+public:
+
+    // Restores the emulator state from this snapshot
+    void restore(Amiga &amiga) const throws;
+
+    // Restores the emulator state from a stream, one chunk at a time
+    static void restore(Amiga &amiga, std::istream &stream) throws;
+
+private:
+
+    static void restore(Amiga &amiga, const SnapshotChunk *chunks, isize count,
+                        std::function<const u8 *(isize)> read) throws;
 };
 
 }
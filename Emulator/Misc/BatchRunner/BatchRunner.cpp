@@ -0,0 +1,192 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "BatchRunner.h"
+#include "Emulator.h"
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+namespace vamiga {
+
+std::vector<BatchResult>
+BatchRunner::run(const std::vector<BatchJob> &jobs, isize threads)
+{
+    auto count = isize(jobs.size());
+
+    // Determine the number of workers
+    if (threads <= 0) threads = isize(std::thread::hardware_concurrency());
+    threads = std::clamp(threads, isize(1), std::max(count, isize(1)));
+
+    // Distribute the jobs among the workers
+    this->jobs = &jobs;
+    queues = std::vector<WorkQueue>(threads);
+    results = std::vector<BatchResult>(count);
+    for (isize i = 0; i < count; i++) queues[i % threads].jobs.push_back(i);
+
+    debug(RUN_DEBUG, "Running %ld jobs on %ld threads\n", count, threads);
+
+    // Launch the workers and wait for them to finish
+    std::vector<std::thread> workers;
+    for (isize i = 0; i < threads; i++) workers.emplace_back(&BatchRunner::work, this, i);
+    for (auto &worker : workers) worker.join();
+
+    this->jobs = nullptr;
+    queues.clear();
+    return std::move(results);
+}
+
+void
+BatchRunner::work(isize nr)
+{
+    isize job;
+
+    while (fetch(nr, job)) {
+
+        results[job] = execute((*jobs)[job]);
+
+        debug(RUN_DEBUG, "Worker %ld: %s: %s\n", nr,
+              results[job].name.c_str(), BatchExitEnum::key(results[job].exit));
+    }
+}
+
+bool
+BatchRunner::fetch(isize nr, isize &job)
+{
+    auto count = isize(queues.size());
+
+    for (isize i = 0; i < count; i++) {
+
+        auto &queue = queues[(nr + i) % count];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+
+        if (queue.jobs.empty()) continue;
+
+        if (i == 0) {
+
+            // Take the next job from the own queue
+            job = queue.jobs.front();
+            queue.jobs.pop_front();
+
+        } else {
+
+            // Steal a job from the end of another queue
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+        }
+        return true;
+    }
+
+    return false;
+}
+
+BatchResult
+BatchRunner::execute(const BatchJob &job)
+{
+    BatchResult result = { .name = job.name, .exit = BATCH_EXIT_ERROR };
+    util::Clock clock;
+
+    try {
+
+        // Create an emulator instance that is driven by this thread
+        Emulator emulator;
+        emulator.attach();
+
+        auto &amiga = emulator.main;
+        bool scriptDone = false;
+        bool done = false;
+
+        // Disable video output if the job doesn't need it
+        if (job.noVideo) emulator.set(OPT_DENISE_VIDEO_OUTPUT, false);
+
+        // Record the shell output to be able to report script errors
+        std::stringstream log;
+        amiga.retroShell.setStream(log);
+        amiga.retroShell.execScript(job.script);
+
+        while (!done) {
+
+            // Compute the next frame
+            auto start = amiga.cpu.getCpuClock();
+            if (emulator.step()) {
+
+                result.frames++;
+                result.cycles += std::max(amiga.cpu.getCpuClock() - start, i64(0));
+            }
+
+            // Process all pending messages
+            Message msg;
+            while (!done && amiga.msgQueue.get(msg)) {
+
+                switch (msg.type) {
+
+                    case MSG_RSH_EXEC:
+
+                        scriptDone = true;
+                        break;
+
+                    case MSG_RSH_ERROR:
+                    {
+                        auto text = log.str();
+                        auto first = text.rfind("Line ");
+                        auto last = text.rfind('\n');
+
+                        result.message = first != string::npos && last > first ?
+                        text.substr(first, last - first) : "Script error";
+                        done = true;
+                        break;
+                    }
+                    case MSG_ABORT:
+
+                        result.exit = BATCH_EXIT_TESTER;
+                        result.retValue = isize(msg.value);
+                        done = true;
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+            if (done) break;
+
+            // Check the budgets
+            if (job.maxFrames && result.frames >= job.maxFrames) {
+
+                result.exit = BATCH_EXIT_FRAMES;
+                done = true;
+
+            } else if (job.maxCycles && result.cycles >= job.maxCycles) {
+
+                result.exit = BATCH_EXIT_CYCLES;
+                done = true;
+
+            } else if (!emulator.isRunning()) {
+
+                // Nothing will happen anymore if the emulator has stopped
+                if (scriptDone) {
+                    result.exit = BATCH_EXIT_SCRIPT;
+                } else {
+                    result.message = "The emulator stopped while the script is waiting";
+                }
+                done = true;
+            }
+        }
+
+    } catch (std::exception &e) {
+
+        result.exit = BATCH_EXIT_ERROR;
+        result.message = e.what();
+    }
+
+    result.seconds = clock.getElapsedTime().asSeconds();
+    return result;
+}
+
+}
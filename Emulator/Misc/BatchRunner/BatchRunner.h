@@ -0,0 +1,86 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BatchRunnerTypes.h"
+#include "CoreObject.h"
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace vamiga {
+
+/* The batch runner executes a large number of short emulator runs, e.g., the
+ * boot tests of a compatibility test suite. Each job is executed by a private
+ * emulator instance that is driven by one of the runner's worker threads. No
+ * emulator thread is launched and no message listener is registered. Instead,
+ * the worker computes one frame after another and polls the message queue in
+ * between.
+ *
+ * A job is described by a RetroShell script which sets up the emulator and
+ * powers it on. The job terminates if the regression tester has finished, if
+ * the frame or cycle budget has been used up, or if the emulator has stopped
+ * after the script has been executed.
+ *
+ * The jobs are distributed among the workers in a round-robin fashion. Each
+ * worker has its own job queue. If a queue runs dry, the worker steals jobs
+ * from the other queues. Because the jobs may differ significantly in their
+ * run time, this keeps all workers busy until the end of the batch.
+ */
+class BatchRunner final : public CoreObject {
+
+    // Job queue of a single worker
+    struct WorkQueue {
+
+        std::mutex mutex;
+        std::deque<isize> jobs;
+    };
+
+    // The jobs to process
+    const std::vector<BatchJob> *jobs = nullptr;
+
+    // The job queues (one per worker)
+    std::vector<WorkQueue> queues;
+
+    // The collected results (same order as the jobs)
+    std::vector<BatchResult> results;
+
+
+    //
+    // Methods from CoreObject
+    //
+
+public:
+
+    const char *objectName() const override { return "BatchRunner"; }
+
+
+    //
+    // Running jobs
+    //
+
+public:
+
+    // Runs all jobs with the specified number of worker threads (0 = auto)
+    std::vector<BatchResult> run(const std::vector<BatchJob> &jobs, isize threads = 0);
+
+    // Runs a single job in the calling thread
+    static BatchResult execute(const BatchJob &job);
+
+private:
+
+    // Main function of a worker thread
+    void work(isize nr);
+
+    // Takes a job from the worker's own queue or steals one from another queue
+    bool fetch(isize nr, isize &job);
+};
+
+}
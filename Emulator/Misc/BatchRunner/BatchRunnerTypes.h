@@ -0,0 +1,100 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "Types.h"
+#include "Reflection.h"
+
+//
+// Enumerations
+//
+
+/// Reason why a batch job has terminated
+enum_long(BATCH_EXIT)
+{
+    BATCH_EXIT_SCRIPT,      ///< The script has been executed completely
+    BATCH_EXIT_TESTER,      ///< The regression tester has terminated the run
+    BATCH_EXIT_FRAMES,      ///< The frame budget has been used up
+    BATCH_EXIT_CYCLES,      ///< The cycle budget has been used up
+    BATCH_EXIT_ERROR        ///< The job could not be executed
+};
+typedef BATCH_EXIT BatchExit;
+
+#ifdef __cplusplus
+struct BatchExitEnum : util::Reflection<BatchExitEnum, BatchExit>
+{
+    static constexpr long minVal = 0;
+    static constexpr long maxVal = BATCH_EXIT_ERROR;
+    static bool isValid(auto val) { return val >= minVal && val <= maxVal; }
+
+    static const char *prefix() { return "BATCH_EXIT"; }
+    static const char *_key(long value)
+    {
+        switch (value) {
+
+            case BATCH_EXIT_SCRIPT:     return "SCRIPT";
+            case BATCH_EXIT_TESTER:     return "TESTER";
+            case BATCH_EXIT_FRAMES:     return "FRAMES";
+            case BATCH_EXIT_CYCLES:     return "CYCLES";
+            case BATCH_EXIT_ERROR:      return "ERROR";
+        }
+        return "???";
+    }
+};
+#endif
+
+
+//
+// Structures
+//
+
+typedef struct
+{
+    // Name of the job (used to identify the result)
+    string name;
+
+    // RetroShell script that sets up and starts the emulator
+    string script;
+
+    // Maximum number of emulated frames (0 = unlimited)
+    i64 maxFrames;
+
+    // Maximum number of emulated CPU cycles (0 = unlimited)
+    i64 maxCycles;
+
+    // Skips all drawing stages (for jobs that only check memory or registers)
+    bool noVideo;
+}
+BatchJob;
+
+typedef struct
+{
+    // Name of the job
+    string name;
+
+    // Reason why the job has terminated
+    BatchExit exit;
+
+    // Exit code reported by the regression tester
+    isize retValue;
+
+    // Number of emulated frames
+    i64 frames;
+
+    // Number of emulated CPU cycles
+    i64 cycles;
+
+    // Elapsed wall-clock time in seconds
+    double seconds;
+
+    // Error description (if any)
+    string message;
+}
+BatchResult;
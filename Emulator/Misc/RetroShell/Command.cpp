@@ -16,9 +16,9 @@
 
 namespace vamiga {
 
-std::vector<string> Command::groups;
-std::stack<isize> Command::groupStack;
-string Command::currentGroup;
+thread_local std::vector<string> Command::groups;
+thread_local std::stack<isize> Command::groupStack;
+thread_local string Command::currentGroup;
 
 void
 Command::pushGroup(const string &description, const string &postfix)
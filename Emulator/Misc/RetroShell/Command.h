@@ -46,13 +46,13 @@ static const std::string string     = "<string>";
 struct Command {
 
     // Textual descriptions of all command groups
-    static std::vector<string> groups;
+    static thread_local std::vector<string> groups;
 
     // Group stack
-    static std::stack<isize> groupStack;
+    static thread_local std::stack<isize> groupStack;
 
     //
-    static string currentGroup;
+    static thread_local string currentGroup;
 
     // Group of this command
     isize group; // DEPRECATED
@@ -334,6 +334,41 @@ CommandConsole::initCommands(Command &root)
 
                 amiga.mem.loadExt(argv.front());
             });
+
+            root.add({cmd, "profile"},
+                     "Memory access profiling");
+
+            root.add({cmd, "profile", ""},
+                     "Displays the number of accesses per memory bank",
+                     [this](Arguments& argv, long value) {
+
+                dump(mem, Category::Stats);
+            });
+
+            root.add({cmd, "profile", "clear"},
+                     "Deletes all recorded profiling data",
+                     [this](Arguments& argv, long value) {
+
+                mem.clearProfile();
+            });
+
+            root.add({cmd, "profile", "csv"}, { Arg::path },
+                     "Exports the recorded profiling data in CSV format",
+                     [this](Arguments& argv, long value) {
+
+                std::ofstream os(argv[0]);
+                if (!os.is_open()) throw Error(ERROR_FILE_CANT_WRITE, argv[0]);
+                mem.exportProfile(os, false);
+            });
+
+            root.add({cmd, "profile", "json"}, { Arg::path },
+                     "Exports the recorded profiling data in JSON format",
+                     [this](Arguments& argv, long value) {
+
+                std::ofstream os(argv[0]);
+                if (!os.is_open()) throw Error(ERROR_FILE_CANT_WRITE, argv[0]);
+                mem.exportProfile(os, true);
+            });
         }
 
         //
@@ -354,6 +389,32 @@ CommandConsole::initCommands(Command &root)
             });
 
             initSetters(root, cpu);
+
+            root.add({cmd, "trace"},
+                     "Instruction tracing");
+
+            root.add({cmd, "trace", "start"}, { Arg::path }, { Arg::boolean },
+                     "Streams all executed instructions into a file (optionally with registers)",
+                     [this](Arguments& argv, long value) {
+
+                cpu.startTrace(argv[0], argv.size() > 1 ? parseBool(argv[1]) : false);
+            });
+
+            root.add({cmd, "trace", "stop"},
+                     "Stops recording",
+                     [this](Arguments& argv, long value) {
+
+                cpu.stopTrace();
+            });
+
+            root.add({cmd, "trace", "decode"}, { Arg::src, Arg::dst },
+                     "Translates a recorded trace into a textual listing",
+                     [this](Arguments& argv, long value) {
+
+                std::ofstream os(argv[1]);
+                if (!os.is_open()) throw Error(ERROR_FILE_CANT_WRITE, argv[1]);
+                cpu.decodeTrace(argv[0], os);
+            });
         }
 
         //
@@ -401,6 +462,23 @@ CommandConsole::initCommands(Command &root)
             });
 
             initSetters(root, agnus);
+
+            root.add({cmd, "profile"},
+                     "Event profiling");
+
+            root.add({cmd, "profile", ""},
+                     "Displays the time spent in the event handlers",
+                     [this](Arguments& argv, long value) {
+
+                dump(agnus, Category::Stats);
+            });
+
+            root.add({cmd, "profile", "clear"},
+                     "Deletes all recorded profiling data",
+                     [this](Arguments& argv, long value) {
+
+                agnus.clearProfile();
+            });
         }
 
         //
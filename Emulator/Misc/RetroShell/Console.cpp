@@ -118,7 +118,7 @@ Console::operator<<(std::stringstream &stream)
 const char *
 Console::text()
 {
-    static string all;
+    static thread_local string all;
 
     // Add the storage contents
     storage.text(all);
@@ -9,6 +9,7 @@
 
 #include "config.h"
 #include "Drive.h"
+#include "Amiga.h"
 
 namespace vamiga {
 
@@ -22,4 +23,11 @@ Drive::toggleWriteProtection()
     setFlag(FLAG_PROTECTED, !getFlag(FLAG_PROTECTED));
 }
 
+bool
+Drive::embedsDisk() const
+{
+    // Unmodified disks can be referenced by their checksum
+    return amiga.getConfig().snapshotEmbed || !hasUnmodifiedDisk();
+}
+
 }
@@ -70,6 +70,9 @@ public:
     bool hasUnprotectedDisk() const { return hasDisk() && !hasProtectedDisk(); }
     void toggleWriteProtection();
 
+    // Checks whether snapshots store the disk contents or a reference
+    bool embedsDisk() const;
+
     // Changes the modification state
     virtual void setModificationFlag(bool value) = 0;
     virtual void setProtectionFlag(bool value) = 0;
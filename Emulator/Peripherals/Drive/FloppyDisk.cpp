@@ -46,6 +46,7 @@ FloppyDisk::init(SerReader &reader, Diameter dia, Density den, bool wp)
 {
     init(dia, den, wp);
     serialize(reader);
+    markAsDirty();
 }
 
 FloppyDisk::~FloppyDisk()
@@ -53,6 +54,28 @@ FloppyDisk::~FloppyDisk()
     debug(OBJ_DEBUG, "Deleting disk\n");
 }
 
+FloppyDisk&
+FloppyDisk::operator= (const FloppyDisk& other)
+{
+    CLONE(diameter)
+    CLONE(density)
+    CLONE_ARRAY(length.track)
+    CLONE(flags)
+
+    // Clone all tracks that have been modified in either instance
+    for (isize t = 0; t < 168; t++) {
+
+        if (dirty[t] || other.dirty[t]) {
+
+            debug(RUA_DEBUG, "Cloning track %ld\n", t);
+            CLONE_ARRAY(data.track[t])
+            dirty[t] = false;
+        }
+    }
+
+    return *this;
+}
+
 void
 FloppyDisk::_dump(Category category, std::ostream& os) const
 {
@@ -152,6 +175,7 @@ FloppyDisk::writeBit(Track t, isize offset, bool value) {
     } else {
         data.track[t][offset / 8] &= (0xFF7F >> (offset & 7));
     }
+    dirty[t] = true;
 }
 
 void
@@ -160,10 +184,11 @@ FloppyDisk::writeBit(Cylinder c, Head h, isize offset, bool value) {
     assert(isValidHeadPos(c, h, offset));
 
     if (value) {
-        data.cylinder[h][c][offset / 8] |= (0x0080 >> (offset & 7));
+        data.cylinder[c][h][offset / 8] |= (0x0080 >> (offset & 7));
     } else {
-        data.cylinder[h][c][offset / 8] &= (0xFF7F >> (offset & 7));
+        data.cylinder[c][h][offset / 8] &= (0xFF7F >> (offset & 7));
     }
+    dirty[c * 2 + h] = true;
 }
 
 u8
@@ -192,6 +217,7 @@ FloppyDisk::writeByte(Track t, isize offset, u8 value)
     assert(offset < length.track[t]);
 
     data.track[t][offset] = value;
+    dirty[t] = true;
     setModified(true);
 }
 
@@ -203,6 +229,7 @@ FloppyDisk::writeByte(Cylinder c, Head h, isize offset, u8 value)
     assert(offset < length.cylinder[c][h]);
 
     data.cylinder[c][h][offset] = value;
+    dirty[c * 2 + h] = true;
     setModified(true);
 }
 
@@ -227,6 +254,8 @@ FloppyDisk::clearDisk()
             data.track[t][1] = 0xA2;
         }
     }
+
+    markAsDirty();
 }
 
 void
@@ -235,6 +264,8 @@ FloppyDisk::clearDisk(u8 value)
     for (isize i = 0; i < isizeof(data.raw); i++) {
         data.raw[i] = value;
     }
+
+    markAsDirty();
 }
 
 void
@@ -246,6 +277,7 @@ FloppyDisk::clearTrack(Track t)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = rand() & 0xFF;
     }
+    dirty[t] = true;
 }
 
 void
@@ -256,6 +288,7 @@ FloppyDisk::clearTrack(Track t, u8 value)
     for (isize i = 0; i < isizeof(data.track[t]); i++) {
         data.track[t][i] = value;
     }
+    dirty[t] = true;
 }
 
 void
@@ -266,6 +299,7 @@ FloppyDisk::clearTrack(Track t, u8 value1, u8 value2)
     for (isize i = 0; i < length.track[t]; i++) {
         data.track[t][i] = IS_ODD(i) ? value2 : value1;
     }
+    dirty[t] = true;
 }
 
 void
@@ -278,6 +312,7 @@ FloppyDisk::encodeDisk(const FloppyFile &file)
 
     // Call the MFM encoder
     file.encodeDisk(*this);
+    markAsDirty();
 
     // Rectify the track alignment
 
@@ -313,6 +348,8 @@ FloppyDisk::shiftTracks(isize offset)
         memcpy(spare + len, data.track[t], len);
         memcpy(data.track[t], spare + (len + t * offset) % len, len);
     }
+
+    markAsDirty();
 }
 
 void
@@ -416,6 +453,8 @@ FloppyDisk::repeatTracks()
             data.track[t][i] = data.track[t][j];
         }
     }
+
+    markAsDirty();
 }
 
 string
@@ -85,6 +85,9 @@ private:
 
     // Disk state
     DiskFlags flags = 0;
+
+    // Keeps track of modified tracks (to update the run-ahead instance)
+    bool dirty[168];
     
     
     //
@@ -93,7 +96,7 @@ private:
     
 public:
     
-    FloppyDisk() = default;
+    FloppyDisk() { markAsDirty(); }
     FloppyDisk(Diameter dia, Density den, bool wp = false) throws { init(dia, den, wp); }
     FloppyDisk(const FloppyFile &file, bool wp = false) throws { init(file, wp); }
     FloppyDisk(SerReader &reader, Diameter dia, Density den, bool wp = false) throws {
@@ -109,16 +112,7 @@ private:
     
 public:
 
-    FloppyDisk& operator= (const FloppyDisk& other) {
-
-        CLONE(diameter)
-        CLONE(density)
-        CLONE_ARRAY(data.raw)
-        CLONE_ARRAY(length.track)
-        CLONE(flags)
-
-        return *this;
-    }
+    FloppyDisk& operator= (const FloppyDisk& other);
 
 
     //
@@ -213,6 +207,18 @@ public:
     void writeByte(Cylinder c, Head h, isize offset, u8 value);
     
     
+    
+    //
+    // Tracking modified tracks
+    //
+
+public:
+
+    // Marks all tracks as modified or unmodified
+    void markAsDirty() { for (isize t = 0; t < 168; t++) dirty[t] = true; }
+    void markAsClean() { for (isize t = 0; t < 168; t++) dirty[t] = false; }
+
+    
     //
     // Erasing
     //
@@ -58,6 +58,13 @@ FloppyDrive::operator= (const FloppyDrive& other) {
     return *this;
 }
 
+void
+FloppyDrive::markAsClean()
+{
+    if (disk) disk->markAsClean();
+    if (diskToInsert) diskToInsert->markAsClean();
+}
+
 void
 FloppyDrive::_initialize()
 {
@@ -350,9 +357,12 @@ FloppyDrive::operator << (SerCounter &worker)
 
     if (hasDisk()) {
 
-        // Add the disk type and disk state
+        // Add the disk type and a boolean indicating whether the disk is embedded
         worker << disk->getDiameter() << disk->getDensity();
-        disk->serialize(worker);
+        worker.count += sizeof(bool);
+
+        // Add the size of the disk state or the size of its checksum
+        if (embedsDisk()) { disk->serialize(worker); } else { worker << u64(0); }
     }
 }
 
@@ -369,8 +379,26 @@ FloppyDrive::operator << (SerReader &worker)
 
         Diameter type;
         Density density;
-        worker << type << density;
-        disk = std::make_unique<FloppyDisk>(worker, type, density);
+        bool embedded;
+        worker << type << density << embedded;
+
+        if (embedded) {
+
+            disk = std::make_unique<FloppyDisk>(worker, type, density);
+
+        } else {
+
+            // The snapshot refers to the currently inserted disk
+            u64 checksum; worker << checksum;
+
+            if (!hasDisk() ||
+                disk->getDiameter() != type ||
+                disk->getDensity() != density ||
+                disk->checksum() != checksum) {
+
+                throw Error(ERROR_SNAP_MEDIA_MISMATCH);
+            }
+        }
 
     } else {
 
@@ -391,8 +419,9 @@ FloppyDrive::operator << (SerWriter &worker)
         // Write the disk type
         worker << disk->getDiameter() << disk->getDensity();
 
-        // Write the disk's state
-        disk->serialize(worker);
+        // Write the disk's state or reference the disk by its checksum
+        bool embedded = embedsDisk(); worker << embedded;
+        if (embedded) { disk->serialize(worker); } else { worker << disk->checksum(); }
     }
 }
 
@@ -1174,6 +1203,9 @@ FloppyDrive::serviceDiskChangeEvent()
             
             // Insert the new disk
             disk = std::move(diskToInsert);
+
+            // The disk has changed its slot and must be cloned in full
+            disk->markAsDirty();
             
             // Remove indeterminism by repositioning the drive head
             head.offset = 0;
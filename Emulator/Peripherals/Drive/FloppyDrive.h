@@ -133,6 +133,9 @@ public:
 
     FloppyDrive& operator= (const FloppyDrive& other);
 
+    // Marks all tracks of the inserted disks as unmodified
+    void markAsClean();
+
 
     //
     // Methods from CoreObject
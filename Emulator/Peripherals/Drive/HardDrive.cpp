@@ -17,8 +17,6 @@
 
 namespace vamiga {
 
-std::fstream HardDrive::wtStream[4];
-
 HardDrive::HardDrive(Amiga& ref, isize nr) : Drive(ref, nr)
 {
 
@@ -48,22 +46,16 @@ HardDrive::operator= (const HardDrive& other) {
     CLONE(flags)
     CLONE(bootable)
 
-    if (RUA_ON_STEROIDS) {
-
-        // Clone all blocks
-        CLONE(data)
-
-    } else {
-
-        // Clone dirty blocks
-        data.resize(other.data.size);
-        for (isize i = 0; i < other.dirty.size; i++) {
+    // Clone all blocks that have been modified in either instance
+    data.resize(other.data.size);
+    dirty.resize(other.dirty.size, true);
+    for (isize i = 0; i < other.dirty.size; i++) {
 
-            if (other.dirty[i]) {
+        if (other.dirty[i] || dirty[i]) {
 
-                debug(RUA_DEBUG, "Cloning block %ld\n", i);
-                memcpy(data.ptr + 512 * i, other.data.ptr + 512 * i, 512);
-            }
+            debug(RUA_DEBUG, "Cloning block %ld\n", i);
+            memcpy(data.ptr + 512 * i, other.data.ptr + 512 * i, 512);
+            dirty[i] = false;
         }
     }
 
@@ -403,6 +395,57 @@ HardDrive::cacheInfo(HardDriveInfo &info) const
     }
 }
 
+void
+HardDrive::operator << (SerChecker &worker)
+{
+    serialize(worker);
+
+    worker << data;
+}
+
+void
+HardDrive::operator << (SerCounter &worker)
+{
+    // Add the size of a boolean indicating whether the data is embedded
+    worker.count += sizeof(bool);
+
+    // Add the size of the disk data or the size of its checksum
+    if (embedsDisk()) { worker << data; } else { worker << u64(0); }
+
+    serialize(worker);
+}
+
+void
+HardDrive::operator << (SerReader &worker)
+{
+    // Check if the snapshot includes the disk data
+    bool embedded; worker << embedded;
+
+    if (embedded) {
+
+        worker << data;
+
+    } else {
+
+        // The snapshot refers to the data of the currently attached disk
+        u64 fnv; worker << fnv;
+        if (fnv != data.fnv64()) throw Error(ERROR_SNAP_MEDIA_MISMATCH);
+    }
+
+    serialize(worker);
+}
+
+void
+HardDrive::operator << (SerWriter &worker)
+{
+    // Embed the disk data or reference it by its checksum
+    bool embedded = embedsDisk(); worker << embedded;
+
+    if (embedded) { worker << data; } else { worker << data.fnv64(); }
+
+    serialize(worker);
+}
+
 void
 HardDrive::_didLoad()
 {
@@ -560,7 +603,7 @@ HardDrive::disableWriteThrough()
     if (writeThrough) {
         
         // Close file
-        wtStream[objid].close();
+        wtStream.close();
         
         debug(WT_DEBUG, "Write-through mode disabled\n");
         writeThrough = false;
@@ -583,8 +626,8 @@ HardDrive::saveWriteThroughImage()
         throw Error(ERROR_WT, "No storage path specified");
     }
     
-    // Only proceed if no other emulator instance is using the storage file
-    if (wtStream[objid].is_open()) {
+    // Only proceed if the storage file is not in use already
+    if (wtStream.is_open()) {
         throw Error(ERROR_WT_BLOCKED);
     }
     
@@ -597,8 +640,8 @@ HardDrive::saveWriteThroughImage()
         throw Error(ERROR_WT, "Can't create storage file");
     }
     // Open file
-    wtStream[objid].open(path, std::ios::binary | std::ios::in | std::ios::out);
-    if (!wtStream[objid].is_open()) {
+    wtStream.open(path, std::ios::binary | std::ios::in | std::ios::out);
+    if (!wtStream.is_open()) {
         throw Error(ERROR_WT, "Can't open storage file");
     }
 }
@@ -639,6 +682,9 @@ HardDrive::format(FSVolumeType fsType, string name)
 
         // Copy all blocks over
         fs.exportVolume(data.ptr, geometry.numBytes());
+
+        // Mark all blocks as dirty
+        dirty.clear(true);
     }
 }
 
@@ -711,14 +757,19 @@ HardDrive::write(isize offset, isize length, u32 addr)
 
             // Perform the write operation
             mem.spypeek <ACCESSOR_CPU> (addr, length, data.ptr + offset);
+
+            // Mark all affected blocks as dirty
+            for (isize i = offset / 512; i < (offset + length + 511) / 512; i++) {
+                dirty[i] = true;
+            }
             
             // Handle write-through mode
             if (writeThrough) {
-                wtStream[objid].seekp(offset);
-                wtStream[objid].write((char *)(data.ptr + offset), length);
+                wtStream.seekp(offset);
+                wtStream.write((char *)(data.ptr + offset), length);
             }
             
-            setFlag(FLAG_PROTECTED, true);
+            setFlag(FLAG_MODIFIED, true);
         }
         
         // Inform the GUI
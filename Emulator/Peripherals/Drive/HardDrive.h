@@ -53,8 +53,8 @@ class HardDrive : public Drive, public Inspectable<HardDriveInfo> {
     friend class HDFFile;
     friend class HdController;
 
-    // Write-through storage files
-    static std::fstream wtStream[4];
+    // Write-through storage file
+    std::fstream wtStream;
     
     // Current configuration
     HardDriveConfig config = {};
@@ -107,6 +107,9 @@ public:
     
     HardDrive& operator= (const HardDrive& other);
 
+    // Marks all blocks as unmodified
+    void markAsClean() { dirty.clear(false); }
+
     // Creates a hard drive with a certain geometry
     void init(const GeometryDescriptor &geometry);
 
@@ -127,7 +130,7 @@ public:
 
     const HardDriveTraits &getTraits() const {
 
-        static HardDriveTraits traits;
+        static thread_local HardDriveTraits traits;
 
         traits.nr = objid;
         
@@ -155,7 +158,7 @@ public:
 
     const PartitionTraits &getPartitionTraits(isize nr) const {
 
-        static PartitionTraits traits;
+        static thread_local PartitionTraits traits;
 
         auto descr = getPartitionDescriptor(nr);
         traits.nr = nr;
@@ -217,11 +220,15 @@ private:
         << geometry
         << ptable
         << drivers
-        << data
         << flags
         << bootable;
+    }
 
-    } SERIALIZERS(serialize);
+    void operator << (SerResetter &worker) override { serialize(worker); };
+    void operator << (SerChecker &worker) override;
+    void operator << (SerCounter &worker) override;
+    void operator << (SerReader &worker) override;
+    void operator << (SerWriter &worker) override;
 
     void _didReset(bool hard) override;
     void _didLoad() override;
@@ -84,12 +84,7 @@ Allocator<T>::init(const T *buf, isize elements)
     
     alloc(elements);
     
-    if (ptr) {
-        
-        for (isize i = 0; i < size; i++) {
-            ptr[i] = buf[i];
-        }
-    }
+    if (ptr) memcpy((void *)ptr, (const void *)buf, size * sizeof(T));
 }
 
 template <class T> void
@@ -184,12 +179,7 @@ Allocator<T>::copy(T *buf, isize offset, isize len) const
     assert((size == 0) == (ptr == nullptr));
     assert(offset >= 0 && len >= 0 && offset + len <= size);
     
-    if (ptr) {
-        
-        for (isize i = 0; i < len; i++) {
-            buf[i] = ptr[i + offset];
-        }
-    }
+    if (ptr) memcpy((void *)buf, (const void *)(ptr + offset), len * sizeof(T));
 }
 
 template <class T> void
@@ -10,23 +10,12 @@
 #include "config.h"
 #include "Checksum.h"
 #include "Macros.h"
+#include "MemUtils.h"
+#include <bit>
+#include <cstring>
 
 namespace util {
 
-u32
-NO_SANITIZE("unsigned-integer-overflow")
-fnvIt32(u32 prv, u32 val)
-{
-    return (prv ^ val) * 0x1000193;
-}
-
-u64
-NO_SANITIZE("unsigned-integer-overflow")
-fnvIt64(u64 prv, u64 val)
-{
-    return (prv ^ val) * 0x100000001b3;
-}
-
 u32
 fnv32(const u8 *addr, isize size)
 {
@@ -55,6 +44,87 @@ fnv64(const u8 *addr, isize size)
     return hash;
 }
 
+static constexpr u64 prime1 = 0x9E3779B185EBCA87;
+static constexpr u64 prime2 = 0xC2B2AE3D27D4EB4F;
+static constexpr u64 prime3 = 0x165667B19E3779F9;
+static constexpr u64 prime4 = 0x85EBCA77C2B2AE63;
+static constexpr u64 prime5 = 0x27D4EB2F165667C5;
+
+static inline u64 rotl64(u64 x, int r) { return (x << r) | (x >> (64 - r)); }
+
+static inline u64 load64(const u8 *p)
+{
+    u64 v; std::memcpy(&v, p, 8);
+    return std::endian::native == std::endian::big ? SWAP64(v) : v;
+}
+
+static inline u32 load32(const u8 *p)
+{
+    u32 v; std::memcpy(&v, p, 4);
+    return std::endian::native == std::endian::big ? SWAP32(v) : v;
+}
+
+static inline u64 NO_SANITIZE("unsigned-integer-overflow")
+round64(u64 acc, u64 input)
+{
+    return rotl64(acc + input * prime2, 31) * prime1;
+}
+
+static inline u64 NO_SANITIZE("unsigned-integer-overflow")
+merge64(u64 acc, u64 val)
+{
+    return (acc ^ round64(0, val)) * prime1 + prime4;
+}
+
+u64 NO_SANITIZE("unsigned-integer-overflow")
+hash64(const u8 *addr, isize size, u64 seed)
+{
+    const u8 *p = addr, *end = addr + size;
+    u64 h;
+
+    if (size >= 32) {
+
+        u64 v1 = seed + prime1 + prime2;
+        u64 v2 = seed + prime2;
+        u64 v3 = seed;
+        u64 v4 = seed - prime1;
+
+        for (; p + 32 <= end; p += 32) {
+
+            v1 = round64(v1, load64(p));
+            v2 = round64(v2, load64(p + 8));
+            v3 = round64(v3, load64(p + 16));
+            v4 = round64(v4, load64(p + 24));
+        }
+
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = merge64(h, v1);
+        h = merge64(h, v2);
+        h = merge64(h, v3);
+        h = merge64(h, v4);
+
+    } else {
+
+        h = seed + prime5;
+    }
+
+    h += u64(size);
+
+    // Process the remaining bytes
+    for (; p + 8 <= end; p += 8) h = rotl64(h ^ round64(0, load64(p)), 27) * prime1 + prime4;
+    for (; p + 4 <= end; p += 4) h = rotl64(h ^ (u64(load32(p)) * prime1), 23) * prime2 + prime3;
+    for (; p < end; p++) h = rotl64(h ^ (*p * prime5), 11) * prime1;
+
+    // Mix all bits
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+
+    return h;
+}
+
 u16 crc16(const u8 *addr, isize size)
 {
     u8 x;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include "BaseTypes.h"
+#include "Macros.h"
 
 namespace util {
 
@@ -18,13 +19,21 @@ inline u32 fnvInit32() { return 0x811c9dc5; }
 inline u64 fnvInit64() { return 0xcbf29ce484222325; }
 
 // Performs a single iteration of the FNV-1a hash algorithm
-u32 fnvIt32(u32 prv, u32 val);
-u64 fnvIt64(u64 prv, u64 val);
+inline u32 NO_SANITIZE("unsigned-integer-overflow")
+fnvIt32(u32 prv, u32 val) { return (prv ^ val) * 0x1000193; }
+inline u64 NO_SANITIZE("unsigned-integer-overflow")
+fnvIt64(u64 prv, u64 val) { return (prv ^ val) * 0x100000001b3; }
 
 // Computes a FNV-1a checksum for a given buffer
 u32 fnv32(const u8 *addr, isize size);
 u64 fnv64(const u8 *addr, isize size);
 
+/* Computes a fast 64-bit hash for a given buffer. The function follows the
+ * design of xxHash64. It processes 32 bytes per iteration in four independent
+ * lanes which makes it much faster than FNV-1a for large buffers.
+ */
+u64 hash64(const u8 *addr, isize size, u64 seed = 0);
+
 // Computes a CRC checksum for a given buffer
 u16 crc16(const u8 *addr, isize size);
 u32 crc32(const u8 *addr, isize size);
@@ -12,6 +12,12 @@
 #include "BaseTypes.h"
 #include <ctime>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 namespace util {
 
 class Time {
@@ -23,6 +29,7 @@ public:
 public:
     
     static Time now();
+    static i64 stamp();
     static Time nanoseconds(i64 value) { return Time(value); }
     static Time microseconds(i64 value) { return Time(value * 1000); }
     static Time milliseconds(i64 value)  { return Time(value * 1000000); }
@@ -63,6 +70,25 @@ public:
     void sleepUntil();
 };
 
+/* Reads a fast hardware counter. The counter ticks at an unspecified, but
+ * constant rate. It is utilized to measure short code sections when profiling
+ * is enabled. On architectures without a suitable counter, the function falls
+ * back to the monotonic system clock.
+ */
+inline i64
+Time::stamp()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    return i64(__rdtsc());
+#elif defined(__aarch64__)
+    u64 result;
+    asm volatile("mrs %0, cntvct_el0" : "=r" (result));
+    return i64(result);
+#else
+    return now().asNanoseconds();
+#endif
+}
+
 class Clock {
         
     Time start;
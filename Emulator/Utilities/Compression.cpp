@@ -0,0 +1,169 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "Compression.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace util {
+
+// Minimum length of a back reference
+static constexpr isize minMatch = 4;
+
+// The last bytes are always stored as literals
+static constexpr isize lastLiterals = 5;
+
+// No match must start in the last bytes
+static constexpr isize mfLimit = 12;
+
+// Maximum distance of a back reference
+static constexpr isize maxOffset = 65535;
+
+// Size of the hash table (log2)
+static constexpr isize hashLog = 16;
+
+static inline u32 load32(const u8 *p) { u32 v; std::memcpy(&v, p, 4); return v; }
+static inline u64 load64(const u8 *p) { u64 v; std::memcpy(&v, p, 8); return v; }
+static inline u32 hash(u32 v) { return (v * 2654435761U) >> (32 - hashLog); }
+
+static u8 *
+writeLength(u8 *op, isize len)
+{
+    for (; len >= 255; len -= 255) *op++ = 255;
+    *op++ = u8(len);
+    return op;
+}
+
+static u8 *
+writeLiterals(u8 *op, const u8 *src, isize len, isize matchLen)
+{
+    *op++ = u8(std::min(len, isize(15)) << 4 | std::min(matchLen, isize(15)));
+    if (len >= 15) op = writeLength(op, len - 15);
+    std::memcpy(op, src, len);
+    return op + len;
+}
+
+isize
+lzBound(isize len)
+{
+    return len + len / 255 + 16;
+}
+
+isize
+lzCompress(const u8 *src, isize len, u8 *dst)
+{
+    u8 *op = dst;
+    isize anchor = 0;
+
+    if (len > mfLimit) {
+
+        std::vector<u32> table(1 << hashLog, 0);
+
+        isize ipLimit = len - mfLimit;
+        isize matchLimit = len - lastLiterals;
+
+        for (isize ip = 0; ip < ipLimit;) {
+
+            auto seq = load32(src + ip);
+            auto h = hash(seq);
+            isize ref = table[h];
+            table[h] = u32(ip);
+
+            // Skip faster through data that doesn't compress
+            if (ref >= ip || ip - ref > maxOffset || load32(src + ref) != seq) {
+
+                ip += 1 + ((ip - anchor) >> 6);
+                continue;
+            }
+
+            // Determine the match length
+            isize matchLen = minMatch;
+            while (ip + matchLen + 8 <= matchLimit &&
+                   load64(src + ref + matchLen) == load64(src + ip + matchLen)) matchLen += 8;
+            while (ip + matchLen < matchLimit &&
+                   src[ref + matchLen] == src[ip + matchLen]) matchLen++;
+
+            // Write the sequence
+            op = writeLiterals(op, src + anchor, ip - anchor, matchLen - minMatch);
+            *op++ = u8(ip - ref);
+            *op++ = u8((ip - ref) >> 8);
+            if (matchLen - minMatch >= 15) op = writeLength(op, matchLen - minMatch - 15);
+
+            ip += matchLen;
+            anchor = ip;
+        }
+    }
+
+    // Write the remaining bytes as literals
+    op = writeLiterals(op, src + anchor, len - anchor, 0);
+
+    return isize(op - dst);
+}
+
+isize
+lzDecompress(const u8 *src, isize len, u8 *dst, isize capacity)
+{
+    isize ip = 0, op = 0;
+
+    auto readLength = [&](isize &value) {
+
+        u8 byte;
+        do {
+            if (ip >= len) return false;
+            byte = src[ip++];
+            value += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (ip < len) {
+
+        u8 token = src[ip++];
+
+        // Copy literals
+        isize litLen = token >> 4;
+        if (litLen == 15 && !readLength(litLen)) return -1;
+        if (litLen > len - ip || litLen > capacity - op) return -1;
+        std::memcpy(dst + op, src + ip, litLen);
+        ip += litLen;
+        op += litLen;
+
+        // The last sequence has no back reference
+        if (ip == len) break;
+
+        // Copy the back reference
+        if (len - ip < 2) return -1;
+        isize offset = src[ip] | src[ip + 1] << 8;
+        ip += 2;
+        if (offset == 0 || offset > op) return -1;
+
+        isize matchLen = token & 15;
+        if (matchLen == 15 && !readLength(matchLen)) return -1;
+        matchLen += minMatch;
+        if (matchLen > capacity - op) return -1;
+
+        // The referenced block may overlap with the destination
+        u8 *d = dst + op;
+        const u8 *s = d - offset;
+        for (isize left = matchLen; left > 0;) {
+
+            isize n = std::min(left, isize(d - s));
+            std::memcpy(d, s, n);
+            d += n;
+            left -= n;
+        }
+        op += matchLen;
+    }
+
+    return op;
+}
+
+}
@@ -0,0 +1,34 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BaseTypes.h"
+
+namespace util {
+
+/* The LZ compressor encodes data as a sequence of literal runs and back
+ * references. It uses the block format of the LZ4 algorithm, i.e., each
+ * sequence starts with a token byte holding the literal length in the upper
+ * nibble and the match length in the lower nibble. The literals and a 16-bit
+ * match offset (little endian) follow. The last sequence consists of literals
+ * only. The compressor favors speed over compression ratio which makes it
+ * suitable for compressing large memory blocks such as RAM or disk data.
+ */
+
+// Returns the maximum size of the compressed data
+isize lzBound(isize len);
+
+// Compresses a buffer and returns the number of written bytes
+isize lzCompress(const u8 *src, isize len, u8 *dst);
+
+// Decompresses a buffer and returns the number of written bytes (-1 on error)
+isize lzDecompress(const u8 *src, isize len, u8 *dst, isize capacity);
+
+}
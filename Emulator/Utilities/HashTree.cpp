@@ -0,0 +1,134 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#include "config.h"
+#include "HashTree.h"
+#include "Checksum.h"
+#include <algorithm>
+#include <thread>
+
+namespace util {
+
+void
+HashTree::init(const u8 *addr, isize size)
+{
+    this->size = size;
+    levels.clear();
+
+    // Compute the leaves
+    levels.emplace_back((size + blockSize - 1) / blockSize);
+    hashBlocks(addr, size, levels[0].data());
+
+    // Compute the inner nodes
+    while (levels.back().size() > 1) {
+
+        auto &below = levels.back();
+        std::vector<u64> level((below.size() + 1) / 2);
+
+        for (usize i = 0; i < level.size(); i++) {
+
+            level[i] = 2 * i + 1 < below.size() ?
+            combine(below[2 * i], below[2 * i + 1]) : below[2 * i];
+        }
+        levels.push_back(std::move(level));
+    }
+}
+
+u64
+HashTree::checksum() const
+{
+    return combine(levels.empty() || levels.back().empty() ? 0 : levels.back()[0], u64(size));
+}
+
+isize
+HashTree::firstMismatch(const HashTree &other) const
+{
+    if (checksum() == other.checksum()) return -1;
+
+    // If the trees have different shapes, the first block is reported
+    if (size != other.size || levels.empty()) return 0;
+
+    // Descend into the first diverging subtree
+    isize i = 0;
+    for (isize l = isize(levels.size()) - 2; l >= 0; l--) {
+
+        auto &mine = levels[l];
+        auto &theirs = other.levels[l];
+
+        i = 2 * i;
+        if (mine[i] == theirs[i] && i + 1 < isize(mine.size())) i++;
+    }
+    return i;
+}
+
+u64
+HashTree::hash(const u8 *addr, isize size)
+{
+    // Small blocks are hashed directly
+    if (size <= blockSize) {
+
+        return combine(size ? hash64(addr, size) : 0, u64(size));
+    }
+
+    return HashTree(addr, size).checksum();
+}
+
+void
+HashTree::hashBlocks(const u8 *addr, isize size, u64 *leaves)
+{
+    isize count = (size + blockSize - 1) / blockSize;
+
+    auto work = [&](isize first, isize last) {
+
+        for (isize i = first; i < last; i++) {
+
+            auto offset = i * blockSize;
+            leaves[i] = hash64(addr + offset, std::min(blockSize, size - offset));
+        }
+    };
+
+    // Determine the number of worker threads
+    isize workers = 1;
+    if (size >= parallelThreshold) {
+
+        workers = std::max(1, int(std::thread::hardware_concurrency()));
+        workers = std::min(workers, size / (parallelThreshold / 4));
+    }
+
+    if (workers == 1) { work(0, count); return; }
+
+    // Distribute the blocks among the worker threads
+    std::vector<std::thread> threads;
+    isize chunk = (count + workers - 1) / workers;
+
+    for (isize w = 1; w < workers; w++) {
+
+        auto first = std::min(count, w * chunk);
+        auto last = std::min(count, first + chunk);
+        threads.emplace_back(work, first, last);
+    }
+    work(0, std::min(count, chunk));
+
+    for (auto &t : threads) t.join();
+}
+
+u64
+HashTree::combine(u64 left, u64 right)
+{
+    u8 bytes[16];
+
+    for (isize i = 0; i < 8; i++) {
+
+        bytes[i] = u8(left >> (8 * i));
+        bytes[i + 8] = u8(right >> (8 * i));
+    }
+    return hash64(bytes, 16);
+}
+
+}
@@ -0,0 +1,73 @@
+// -----------------------------------------------------------------------------
+// This file is part of vAmiga
+//
+// Copyright (C) Dirk W. Hoffmann. www.dirkwhoffmann.de
+// Licensed under the Mozilla Public License v2
+//
+// See https://mozilla.org/MPL/2.0 for license information
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include "BaseTypes.h"
+#include <vector>
+
+namespace util {
+
+/* A hash tree (Merkle tree) over a memory block. The leaves are the hashes
+ * of consecutive blocks of 4 KB. Each inner node combines the hashes of its
+ * two children. The root node serves as the checksum of the memory block.
+ * Large memory blocks are hashed in parallel by multiple worker threads.
+ *
+ * Two trees can be compared in O(log n) steps by descending into the first
+ * diverging subtree. This is utilized to pinpoint the first memory page in
+ * which two memory blocks differ.
+ */
+class HashTree {
+
+public:
+
+    // Size of a leaf block in bytes
+    static constexpr isize blockSize = 4096;
+
+    // Memory blocks of this size or above are hashed in parallel
+    static constexpr isize parallelThreshold = 1024 * 1024;
+
+private:
+
+    // All tree levels (the first level contains the leaves)
+    std::vector<std::vector<u64>> levels;
+
+    // Size of the hashed memory block in bytes
+    isize size = 0;
+
+public:
+
+    HashTree() { }
+    HashTree(const u8 *addr, isize size) { init(addr, size); }
+
+    // Computes the tree for a memory block
+    void init(const u8 *addr, isize size);
+
+    // Returns the checksum of the memory block
+    u64 checksum() const;
+
+    // Returns the number of leaf blocks
+    isize blocks() const { return levels.empty() ? 0 : isize(levels[0].size()); }
+
+    // Returns the first block in which two trees differ (-1 if they match)
+    isize firstMismatch(const HashTree &other) const;
+
+    // Computes the checksum of a memory block without keeping the tree
+    static u64 hash(const u8 *addr, isize size);
+
+private:
+
+    // Computes the leaf hashes
+    static void hashBlocks(const u8 *addr, isize size, u64 *leaves);
+
+    // Combines two child hashes or the root hash with the block size
+    static u64 combine(u64 left, u64 right);
+};
+
+}
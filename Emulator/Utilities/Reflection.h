@@ -40,7 +40,7 @@ template <class T, typename E> struct Reflection {
     // Returns the key as a C string
     static const char *key(long value) {
 
-        static string result;
+        static thread_local string result;
 
         result = "";
         if constexpr (T::minVal == 1) {
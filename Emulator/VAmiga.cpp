@@ -10,6 +10,7 @@
 #include "config.h"
 #include "VAmiga.h"
 #include "Emulator.h"
+#include "BatchRunner.h"
 
 namespace vamiga {
 
@@ -107,6 +108,19 @@ AgnusAPI::getStats() const
     return agnus->getStats();
 }
 
+EventProfile
+AgnusAPI::getEventProfile(EventSlot slot, EventID id) const
+{
+    return agnus->getEventProfile(slot, id);
+}
+
+void
+AgnusAPI::clearProfile()
+{
+    agnus->clearProfile();
+    emu->isDirty = true;
+}
+
 const AgnusTraits
 AgnusAPI::getTraits() const
 {
@@ -513,6 +527,28 @@ MemoryAPI::getStats() const
     return mem->getStats();
 }
 
+MemPageProfile
+MemoryAPI::getPageProfile(isize bank) const
+{
+    assert(isUserThread());
+    return mem->getPageProfile(bank);
+}
+
+void
+MemoryAPI::clearProfile()
+{
+    assert(isUserThread());
+    mem->clearProfile();
+    emu->isDirty = true;
+}
+
+void
+MemoryAPI::exportProfile(std::ostream &os, bool json) const
+{
+    assert(isUserThread());
+    mem->exportProfile(os, json);
+}
+
 const RomTraits &
 MemoryAPI::getRomTraits() const
 {
@@ -1649,6 +1685,12 @@ VAmiga::build()
     return Amiga::build();
 }
 
+std::vector<BatchResult>
+VAmiga::runBatch(const std::vector<BatchJob> &jobs, isize threads)
+{
+    return BatchRunner().run(jobs, threads);
+}
+
 const EmulatorInfo &
 VAmiga::getInfo() const
 {
@@ -1917,6 +1959,20 @@ AmigaAPI::loadSnapshot(const MediaFile &snapshot)
     amiga->loadSnapshot(snapshot);
     emu->isDirty = true;
 }
+
+void
+AmigaAPI::loadSnapshot(const std::filesystem::path &path)
+{
+    amiga->loadSnapshot(path);
+    emu->isDirty = true;
+}
+
+void
+AmigaAPI::rewind(isize frames)
+{
+    amiga->rewind(frames);
+    emu->isDirty = true;
+}
     
 u64
 AmigaAPI::getAutoInspectionMask() const
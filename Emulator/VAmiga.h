@@ -100,6 +100,26 @@ public:
      */
     void loadSnapshot(const MediaFile &snapshot);
 
+    /** @brief  Loads a snapshot file into the emulator.
+     *
+     *  The file is read chunk by chunk. Hence, the snapshot does not need to
+     *  be kept in memory as a whole.
+     *
+     *  @param  path        Path to the snapshot file.
+     */
+    void loadSnapshot(const std::filesystem::path &path);
+
+    /** @brief  Reverts the emulator to an earlier state.
+     *
+     *  The emulator restores the newest rewind point recorded before the
+     *  target frame and emulates up to the beginning of this frame. Rewind
+     *  points are recorded if option OPT_AMIGA_REWIND_INTERVAL is set.
+     *
+     *  @param  frames      Number of frames to go back.
+     *  @throw  Error (#ERROR_SNAP_NO_REWIND_POINT)
+     */
+    void rewind(isize frames);
+
     /// @}
     /// @name Auto-inspecting components
     /// @{
@@ -240,6 +260,18 @@ public:
      */
     const AgnusStats &getStats() const;
 
+    /** @brief  Returns the profiling data of a single event.
+     *  @param  slot    Event slot
+     *  @param  id      Event identifier
+     */
+    EventProfile getEventProfile(EventSlot slot, EventID id) const;
+
+    /** @brief  Deletes all recorded event profiling data.
+     *  @note   Profiling data is only recorded if PROFILE_EVENTS is set in
+     *          config.h.
+     */
+    void clearProfile();
+
     /** @brief  Provides details about the currently selected chip revision.
      */
     const AgnusTraits getTraits() const;
@@ -497,6 +529,23 @@ public:
      */
     const MemStats &getStats() const;
 
+    /** @brief  Returns the access histogram of a single memory bank.
+     *  @param  bank    Bank number (0 ... 255). Each bank covers 64 KB.
+     */
+    MemPageProfile getPageProfile(isize bank) const;
+
+    /** @brief  Deletes all recorded memory profiling data.
+     *  @note   Profiling data is only recorded if PROFILE_MEMORY is set in
+     *          config.h.
+     */
+    void clearProfile();
+
+    /** @brief  Exports the access histogram of all accessed banks.
+     *  @param  os      Output stream
+     *  @param  json    Selects JSON format instead of CSV
+     */
+    void exportProfile(std::ostream &os, bool json = false) const;
+
     /** @brief  Provides details about the installed ROM, WOM, or ROM extension.
      */
     const RomTraits &getRomTraits() const;
@@ -1621,6 +1670,23 @@ public:
      */
     static string build();
 
+    /** @brief  Runs a batch of independent emulator instances.
+     *
+     *  Each job is executed by a private emulator instance that is driven by
+     *  a pool of worker threads. No emulator thread is launched and no
+     *  message listener is involved. A job terminates when the regression
+     *  tester exits, when its frame or cycle budget is used up, or when the
+     *  emulator has stopped after the job's script has been executed.
+     *
+     *  @param  jobs        The jobs to execute.
+     *  @param  threads     Number of worker threads (0 = one per core).
+     *  @return The results in the same order as the jobs.
+     *
+     *  @note   Write-through storage files are shared among all instances.
+     *  Hence, batch jobs must not enable the write-through mode.
+     */
+    static std::vector<BatchResult> runBatch(const std::vector<BatchJob> &jobs, isize threads = 0);
+
     
     //
     // Initializing
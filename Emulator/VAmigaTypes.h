@@ -48,6 +48,7 @@
 #include "RomFileTypes.h"
 
 // Miscellaneous
+#include "BatchRunnerTypes.h"
 #include "RemoteManagerTypes.h"
 #include "RemoteServerTypes.h"
 #include "RetroShellTypes.h"
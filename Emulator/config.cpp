@@ -24,9 +24,10 @@ debugflag QUEUE_DEBUG     = 0;
 debugflag SNP_DEBUG       = 0;
 
 // Run ahead
-debugflag RUA_DEBUG       = 1;
+debugflag RUA_DEBUG       = 0;
 debugflag RUA_CHECKSUM    = 0;
 debugflag RUA_ON_STEROIDS = 0;
+debugflag RUA_TEXTURE_CHECK = 0;
 
 // CPU
 debugflag CPU_DEBUG       = 0;
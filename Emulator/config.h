@@ -22,7 +22,7 @@
 // Snapshot version number
 #define SNP_MAJOR 2
 #define SNP_MINOR 6
-#define SNP_SUBMINOR 0
+#define SNP_SUBMINOR 3
 #define SNP_BETA 0
 
 // Uncomment this setting in a release build
@@ -105,6 +105,8 @@
 //
 
 static const int DIAG_BOARD      = 0; // Plug in the diagnose board
+static const int PROFILE_EVENTS  = 0; // Profile the event handlers
+static const int PROFILE_MEMORY  = 0; // Record a memory access histogram
 
 
 //
@@ -154,6 +156,7 @@ extern debugflag SNP_DEBUG;
 extern debugflag RUA_DEBUG;
 extern debugflag RUA_CHECKSUM;
 extern debugflag RUA_ON_STEROIDS;
+extern debugflag RUA_TEXTURE_CHECK;
 
 // CPU
 extern debugflag CPU_DEBUG;